@@ -0,0 +1,46 @@
+// $Id$
+//==============================================================================
+//!
+//! \file AnaStressCache.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author IFEM team / SINTEF
+//!
+//! \brief Cache of analytical stress values at the integration points.
+//!
+//==============================================================================
+
+#ifndef _ANA_STRESS_CACHE_H
+#define _ANA_STRESS_CACHE_H
+
+#include "Function.h"
+#include "Tensor.h"
+#include "PointCache.h"
+
+
+/*!
+  \brief Class caching the values of an analytical stress field.
+
+  \details The values are evaluated once for each integration point and
+  reused in all later passes over the same point, see PointCache.
+  This assumes a stationary analytical solution, i.e., it must not be used
+  for time-dependent fields.
+*/
+
+class AnaStressCache : public PointCache<SymmTensor>
+{
+public:
+  //! \brief Empty default constructor.
+  AnaStressCache() {}
+  //! \brief Empty destructor.
+  virtual ~AnaStressCache() {}
+
+  //! \brief Returns the analytical stress at a point.
+  //! \param[in] func The analytical stress field
+  //! \param[in] X Cartesian coordinates of the point
+  //! \details The field is evaluated only if the point is not in the cache.
+  SymmTensor evaluate(const STensorFunc& func, const Vec3& X);
+};
+
+#endif
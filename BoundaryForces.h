@@ -0,0 +1,138 @@
+// $Id$
+//==============================================================================
+//!
+//! \file BoundaryForces.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author IFEM team / SINTEF
+//!
+//! \brief Integration of force resultants over several boundaries at once.
+//!
+//==============================================================================
+
+#ifndef _BOUNDARY_FORCES_H
+#define _BOUNDARY_FORCES_H
+
+#include "IntegrandBase.h"
+#include "GlobalIntegral.h"
+#include "MatVec.h"
+#include "Vec3.h"
+
+class SIMbase;
+class ASMbase;
+class Elasticity;
+
+
+/*!
+  \brief Class for integration of force resultants over a set of boundaries.
+
+  \details The boundary quadrature is recorded in one pass over all the
+  requested boundaries. For each boundary integration point, it stores only
+  what the traction evaluation needs, i.e., the element number, the basis
+  function values and derivatives, the integration weight, the coordinates
+  and the normal vector. The global node numbers are stored once for each
+  element. Subsequent evaluations, e.g.,
+  one for each time step, then need only the stresses at the recorded points.
+  These are evaluated in parallel over all points of all boundaries. The
+  force and torque resultants of every boundary are returned from one call.
+
+  The recorded points are sorted before use, and the point contributions are
+  summed in that order by the ElementSums class, such that the resultants do
+  not depend on the number of threads. The boundary geometry must not change
+  after the recording.
+
+  The element solution vectors are extracted from the global solution vector
+  using the global node numbers, assuming \a nsd unknowns per node, ordered
+  node by node. The resultants are therefore only supported for serial runs
+  of continuum models without additional nodal unknowns, which is checked
+  by init().
+*/
+
+class BoundaryForces : public IntegrandBase, public GlobalIntegral
+{
+public:
+  //! \brief The constructor binds the force integration to a problem.
+  //! \param[in] p The elasticity problem to evaluate forces for
+  BoundaryForces(Elasticity& p);
+  //! \brief Empty destructor.
+  virtual ~BoundaryForces() {}
+
+  //! \brief Records the boundary quadrature of the given property codes.
+  //! \param[in] model The FE model to record the boundary quadrature for
+  //! \param[in] codes Property codes identifying the boundaries
+  //! \return \e false if the model is not supported, see the class details
+  bool init(const SIMbase& model, const std::vector<int>& codes);
+  //! \brief Returns \e true if the boundary quadrature has been recorded.
+  bool isInitialized() const { return nBnd > 0; }
+
+  //! \brief Defines the reference point for the torque resultants.
+  void setTorquePoint(const Vec3& X) { X0 = X; withTorque = true; }
+
+  //! \brief Evaluates the force resultants of all boundaries.
+  //! \param[out] forces Force (and torque) resultants for each boundary
+  //! \param[in] psol Primary solution vector of the model
+  bool evaluate(Vectors& forces, const Vector& psol) const;
+
+  //! \brief Returns the number of resultant components of each boundary.
+  size_t getNoComps() const;
+
+  using IntegrandBase::getLocalIntegral;
+  //! \brief Returns a local integral container for the given element.
+  //! \param[in] nen Number of nodes on element
+  virtual LocalIntegral* getLocalIntegral(size_t nen, size_t, bool) const;
+
+  using IntegrandBase::initElementBou;
+  //! \brief Initializes current element for boundary integration.
+  //! \param[in] MNPC Matrix of nodal point correspondance for current element
+  //! \param elmInt Local integral for element
+  virtual bool initElementBou(const std::vector<int>& MNPC,
+                              LocalIntegral& elmInt);
+
+  using IntegrandBase::evalBou;
+  //! \brief Records a boundary integration point.
+  //! \param elmInt The local integral object of current element
+  //! \param[in] fe Finite element data of current integration point
+  //! \param[in] X Cartesian coordinates of current integration point
+  //! \param[in] normal Boundary normal vector at current integration point
+  virtual bool evalBou(LocalIntegral& elmInt, const FiniteElement& fe,
+                       const Vec3& X, const Vec3& normal) const;
+
+  //! \brief Nothing to assemble, the points are recorded by \a evalBou.
+  virtual bool assemble(const LocalIntegral*, int) { return true; }
+
+private:
+  //! \brief Data of a recorded boundary integration point.
+  struct BoundaryPoint
+  {
+    size_t ibnd;   //!< 0-based boundary index
+    int    iel;    //!< Global element number
+    double u;      //!< First parameter of the point
+    double v;      //!< Second parameter of the point
+    double w;      //!< Third parameter of the point
+    double detJxW; //!< Jacobian determinant times integration weight
+    Vector N;      //!< Basis function values
+    Matrix dNdX;   //!< Basis function derivatives
+    Vec3   X;      //!< Cartesian coordinates of the point
+    Vec3   n;      //!< Outward-directed boundary normal
+  };
+
+  //! \brief Returns \e true if point \a a is to be summed before point \a b.
+  static bool before(const BoundaryPoint& a, const BoundaryPoint& b);
+
+  Elasticity&    myProblem; //!< The problem to evaluate forces for
+  const ASMbase* myPatch;   //!< The patch currently being recorded
+  size_t         curBnd;    //!< The boundary currently being recorded
+  size_t         nBnd;      //!< Number of boundaries
+
+  Vec3 X0;         //!< Reference point for the torque resultants
+  bool withTorque; //!< If \e true, torque resultants are also computed
+
+  std::vector<BoundaryPoint> points; //!< The recorded integration points
+  //! Global node numbers of each element, indexed by element number
+  std::vector< std::vector<int> > elmNodes;
+  //! Points recorded by each thread, merged into \a points after the pass
+  mutable std::vector< std::vector<BoundaryPoint> > newPoints;
+};
+
+#endif
@@ -0,0 +1,141 @@
+// $Id$
+//==============================================================================
+//!
+//! \file CompiledFunctions.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author IFEM team / SINTEF
+//!
+//! \brief Spatial functions defined by compiled expressions.
+//!
+//==============================================================================
+
+#ifndef _COMPILED_FUNCTIONS_H
+#define _COMPILED_FUNCTIONS_H
+
+#include "Function.h"
+#include "ExprProgram.h"
+#include "MatVec.h"
+#include "Tensor.h"
+#include "Vec3.h"
+
+class TiXmlElement;
+
+
+/*!
+  \brief A scalar-valued spatial function defined by a compiled expression.
+  \details This class is used instead of the interpreted expression function
+  of the kernel whenever the given expression can be compiled, since it avoids
+  the interpreter overhead at each evaluation point.
+*/
+
+class CompiledRealFunc : public RealFunc
+{
+public:
+  //! \brief Empty destructor.
+  virtual ~CompiledRealFunc() {}
+
+  //! \brief Creates a compiled function from the given expression.
+  //! \return A null pointer if the expression could not be compiled
+  static CompiledRealFunc* create(const std::string& expr,
+                                  const std::string& variables = "");
+
+  //! \brief Parses a scalar function, compiling it if it is an expression.
+  //! \param[in] value The function definition
+  //! \param[in] type The function type
+  //! \details If the function is not an expression, or the compilation fails,
+  //! the interpreted function of the kernel is returned instead.
+  static RealFunc* parse(const char* value, const std::string& type);
+
+  //! \brief Returns whether the function is identically zero or not.
+  virtual bool isZero() const
+  { return prg.isConstant() && prg.evaluate(0.0) == 0.0; }
+
+protected:
+  //! \brief The constructor is protected to force use of create().
+  CompiledRealFunc() {}
+
+  //! \brief Evaluates the function at the point \a X.
+  virtual Real evaluate(const Vec3& X) const;
+
+private:
+  ExprProgram prg; //!< The compiled expression
+};
+
+
+/*!
+  \brief A vector-valued spatial function defined by compiled expressions.
+  \details The vector components are separated by a '|' character.
+*/
+
+class CompiledVecFunc : public VecFunc
+{
+public:
+  //! \brief Empty destructor.
+  virtual ~CompiledVecFunc() {}
+
+  //! \brief Creates a compiled function from the given expressions.
+  //! \return A null pointer if the expressions could not be compiled
+  static CompiledVecFunc* create(const std::string& expr,
+                                 const std::string& variables = "");
+
+  //! \brief Parses a vector function, compiling it if it is an expression.
+  //! \param[in] value The function definition
+  //! \param[in] type The function type
+  //! \details If the function is not an expression, or the compilation fails,
+  //! the interpreted function of the kernel is returned instead.
+  static VecFunc* parse(const char* value, const std::string& type);
+
+protected:
+  //! \brief The constructor is protected to force use of create().
+  CompiledVecFunc() {}
+
+  //! \brief Evaluates the function at the point \a X.
+  virtual Vec3 evaluate(const Vec3& X) const;
+
+private:
+  std::vector<ExprProgram> prg; //!< The compiled component expressions
+};
+
+
+/*!
+  \brief A symmetric tensor-valued spatial function of compiled expressions.
+  \details The tensor components are separated by a '|' character and are
+  ordered row-wise over the upper triangle of the tensor, i.e.,
+  \f$s_{11}|s_{12}|s_{22}\f$ in 2D, optionally followed by \f$s_{33}\f$,
+  and \f$s_{11}|s_{12}|s_{13}|s_{22}|s_{23}|s_{33}\f$ in 3D.
+*/
+
+class CompiledSTensorFunc : public STensorFunc
+{
+public:
+  //! \brief Empty destructor.
+  virtual ~CompiledSTensorFunc() {}
+
+  //! \brief Creates a compiled function from the given expressions.
+  //! \return A null pointer if the expressions could not be compiled
+  static CompiledSTensorFunc* create(const std::string& expr,
+                                     const std::string& variables = "");
+
+  //! \brief Creates a compiled stress function from an analytical solution.
+  //! \param[in] elem The XML-element with the analytical solution definition
+  //! \return A null pointer if the element contains other definitions than
+  //! the variables and the stress field, or the expressions could not be
+  //! compiled. The kernel's AnaSol class should then be used instead.
+  static CompiledSTensorFunc* parse(const TiXmlElement* elem);
+
+protected:
+  //! \brief The constructor is protected to force use of create().
+  CompiledSTensorFunc() : nsd(0), with33(false) {}
+
+  //! \brief Evaluates the function at the point \a X.
+  virtual SymmTensor evaluate(const Vec3& X) const;
+
+private:
+  std::vector<ExprProgram> prg; //!< The compiled component expressions
+  unsigned short int nsd; //!< Number of spatial dimensions of the tensor
+  bool with33; //!< If \e true, the 2D tensor includes the 33-component
+};
+
+#endif
@@ -15,13 +15,34 @@
 #define _ELASTICITY_H
 
 #include "ElasticBase.h"
+#include "ElementSums.h"
+#include <tuple>
+#include <map>
 
 class LocalSystem;
+class AnaStressCache;
+template<class T> class PointCache;
+class STensorBatch;
 class Material;
+class SymmTensor;
 class ElmNorm;
 class ElmMats;
 class TiXmlElement;
 
+//! \brief Lame parameters (lambda,mu) at a point.
+typedef std::pair<double,double> LamePair;
+
+
+/*!
+  \brief Factored combination of the load cases of a static simulation.
+*/
+
+struct LoadCombination
+{
+  std::string name;    //!< Name of the load combination
+  RealArray   factors; //!< Load factor of each load case
+};
+
 
 /*!
   \brief Base class representing the integrand of elasticity problems.
@@ -47,6 +68,7 @@ public:
   //! \brief Parses material properties from a character string.
   virtual Material* parseMatProp(char* cline, bool planeStrain = true);
   //! \brief Parses material properties from an XML-element.
+  //! \return Pointer to the new material, or null if the input is invalid
   virtual Material* parseMatProp(const TiXmlElement* elem,
                                  bool planeStrain = true);
 
@@ -68,17 +90,109 @@ public:
   //! \brief Defines the body force field.
   void setBodyForce(VecFunc* bf) { bodyFld = bf; }
 
+  //! \brief Selects the load cases of the current Neumann property.
+  //! \param[in] code Property code of the Neumann boundary condition
+  void setLoadCase(int code);
+  //! \brief Returns the number of load cases (zero if not defined).
+  size_t getNoLoadCases() const { return lcCodes.size(); }
+  //! \brief Returns the load combinations of the load cases.
+  const std::vector<LoadCombination>& getLoadCombinations() const
+  { return lcCombs; }
+
   //! \brief Defines the material properties.
-  void setMaterial(Material* mat) { material = mat; }
+  //! \details Also initializes the integration point tables of the material,
+  //! if the number of integration points is known.
+  void setMaterial(Material* mat);
   //! \brief Defines the local coordinate system for stress output.
   void setLocalSystem(LocalSystem* cs) { locSys = cs; }
 
+  //! \brief Defines the solution mode before the element assembly is started.
+  //! \param[in] mode The solution mode to use
+  virtual void setMode(SIM::SolutionMode mode);
+
   using ElasticBase::initIntegration;
   //! \brief Initializes the integrand with the number of integration points.
   //! \param[in] nGp Total number of interior integration points
   //! \param[in] nBp Total number of boundary integration points
   virtual void initIntegration(size_t nGp, size_t nBp);
 
+  //! \brief Activates or deactivates caching of the analytical stresses.
+  //! \details When active, the analytical stress field is evaluated once for
+  //! each norm integration point, and reused in all subsequent norm passes,
+  //! also on the unrefined elements of an adaptive simulation.
+  void setAnaSolCache(bool enable);
+  //! \brief Returns the analytical stress cache, if active.
+  AnaStressCache* getAnaSolCache() const { return anaCache; }
+
+  //! \brief Activates or deactivates caching of the Lame parameters
+  //! at the norm integration points.
+  //! \details The material properties must not change between the norm
+  //! passes.
+  void setLameCache(bool enable);
+  //! \brief Returns the Lame parameter cache, if active.
+  //! \details The cache is not used if the material is constant,
+  //! since the Lame parameters are then cheaper to evaluate than to look up.
+  PointCache<LamePair>* getLameCache() const;
+
+  //! \brief Activates or deactivates the explicit residual error estimate.
+  //! \details When active, the norm integrand appends a norm group with the
+  //! residual-based error estimate, after the groups of the projections.
+  void setResidualEstimate(bool enable) { resEstimate = enable; }
+  //! \brief Returns \e true if the residual error estimate is active.
+  bool haveResidualEstimate() const { return resEstimate; }
+
+  //! \brief Activates or deactivates deterministic summation of norms.
+  //! \param[in] nel Number of elements in the model (zero deactivates)
+  //! \param[in] nproj Number of projected solutions in the norm evaluation
+  void initNormSums(size_t nel, size_t nproj);
+  //! \brief Stores the norm values of an element for the global summation.
+  //! \param[in] iel 1-based element index
+  //! \param[in] pnorm The element norm values
+  void setElementNorms(size_t iel, const ElmNorm& pnorm);
+  //! \brief Replaces the global norms by deterministic sums of element norms.
+  //! \param gNorm Global norm values, as computed by SIMbase::solutionNorms
+  //! \details The energy and L2-norms are recomputed from the element values
+  //! stored by setElementNorms(), using a fixed summation order, such that
+  //! they do not depend on the number of threads used in the integration.
+  //! Norms with boundary or nodal contributions are left unchanged.
+  //! The element values are process-local, so the summation must not be
+  //! activated in parallel runs, where \a gNorm is reduced over processes.
+  void sumNorms(Vectors& gNorm) const;
+
+  //! \brief Defines the elements of the region of interest.
+  //! \param[in] elms Element flags, one for each element of the model
+  void setRegionOfInterest(const std::vector<bool>& elms) { roiElms = elms; }
+  //! \brief Restricts the post-processing to the region of interest.
+  //! \param[in] active If \e false, the whole model is post-processed
+  //! \return \e true if the post-processing is restricted
+  //!
+  //! \details When active, the norm integration and the tracking of maximum
+  //! result values are skipped for the elements outside the region of
+  //! interest. The secondary solution is still evaluated everywhere, since
+  //! the global projections of the kernel need it on all elements.
+  bool activateRegion(bool active);
+  //! \brief Returns the element flags of the region of interest, if any.
+  const std::vector<bool>& getRegionOfInterest() const { return roiElms; }
+  //! \brief Returns whether an element is to be post-processed.
+  //! \param[in] iel 1-based element index
+  bool inRegion(int iel) const
+  {
+    return !roiActive || iel < 1 || (size_t)iel > roiElms.size() ||
+      roiElms[iel-1];
+  }
+
+  using ElasticBase::finalizeElement;
+  //! \brief Finalizes the element matrices after the numerical integration.
+  //! \param elmInt The local integral object to receive the contributions
+  //! \param[in] time Parameters for nonlinear and time-dependent simulations
+  //! \param[in] iGP Global index of the first integration point in element
+  //!
+  //! \details In a static simulation with several load cases, the volume
+  //! loads integrated into the first element load vector are moved to the
+  //! load vectors of the load cases that contain them.
+  virtual bool finalizeElement(LocalIntegral& elmInt,
+                               const TimeDomain& time, size_t iGP);
+
   //! \brief Initializes the integrand for a new result point loop.
   //! \param[in] lambda Load parameter
   //! \param[in] prinDirs If \e true, compute/store principal directions
@@ -114,6 +228,19 @@ public:
                        const Vec3& X, bool toLocal = false,
                        Vec3* pdir = nullptr) const;
 
+  //! \brief Evaluates the finite element (FE) stresses at several points.
+  //! \param[out] sigma The FE stress tensors at the points
+  //! \param[in] eV Element solution vectors, common to all points
+  //! \param[in] fe Finite element data at the points
+  //! \param[in] X Cartesian coordinates of the points
+  //!
+  //! \details The points must be in the same element. The constitutive
+  //! relation is evaluated for all points in one call, using the batched
+  //! Material::evaluate method. This is for small-strain materials only.
+  bool evalStresses(std::vector<SymmTensor>& sigma, const Vectors& eV,
+                    const std::vector<const FiniteElement*>& fe,
+                    const std::vector<Vec3>& X) const;
+
   //! \brief Evaluates the analytical solution at an integration point.
   //! \param[out] s The analytical stress values at current point
   //! \param[in] asol The analytical solution field
@@ -257,7 +384,20 @@ public:
   //! (in 2D), representing the inverse constitutive tensor
   //! \param[in] fe Finite element data at current point
   //! \param[in] X Cartesian coordinates of current point
-  bool formCinverse(Matrix& Cinv, const FiniteElement& fe, const Vec3& X) const;
+  //! \return Pointer to the inverse constitutive matrix, which is either
+  //! \a Cinv or the precomputed matrix of the material, if it is constant.
+  //! A null pointer is returned if the evaluation failed.
+  const Matrix* formCinverse(Matrix& Cinv,
+                             const FiniteElement& fe, const Vec3& X) const;
+
+  //! \brief Evaluates the Lame-parameters at current point.
+  //! \param[out] lambda Lame's first parameter
+  //! \param[out] mu Lame's second parameter (shear modulus)
+  //! \param[in] fe Finite element data at current point
+  //! \param[in] X Cartesian coordinates of current point
+  //! \return \e false if the material is not linear isotropic
+  bool getLameParameters(double& lambda, double& mu,
+                         const FiniteElement& fe, const Vec3& X) const;
 
   //! \brief Returns \e true if this is an axial-symmetric problem.
   bool isAxiSymmetric() const { return axiSymmetry; }
@@ -270,12 +410,26 @@ protected:
   VecFunc*      fluxFld;  //!< Pointer to explicit boundary traction field
   VecFunc*      bodyFld;  //!< Pointer to body force field
   Vec3Vec*      pDirBuf;  //!< Principal stress directions buffer
+  AnaStressCache* anaCache; //!< Analytical stresses at the norm points
+  PointCache<LamePair>* lameCache; //!< Lame parameters at the norm points
 
   mutable std::vector<PointValue> maxVal;  //!< Maximum result values
   mutable std::vector<Vec3Pair>   tracVal; //!< Traction field point values
 
+  ElementSums normSums; //!< Element norms for deterministic summation
+
+  std::vector<bool> roiElms;   //!< Elements in the region of interest
+  bool              roiActive; //!< If \e true, restrict to the region
+
+  std::vector< std::vector<int> > lcCodes; //!< Neumann codes of load cases
+  std::vector<bool>   lcVolume; //!< Load cases containing the volume loads
+  std::vector<size_t> lcCols; //!< Load cases of current Neumann property
+  std::vector<LoadCombination> lcCombs; //!< Combinations of the load cases
+
+  size_t             nGP; //!< Total number of interior integration points
   unsigned short int nDF; //!< Dimension on deformation gradient (2 or 3)
   bool       axiSymmetry; //!< \e true if the problem is axi-symmetric
+  bool       resEstimate; //!< \e true if the residual estimate is wanted
   double           gamma; //!< Numeric stabilization parameter
 
 public:
@@ -293,13 +447,20 @@ public:
   //! \brief The only constructor initializes its data members.
   //! \param[in] p The linear elasticity problem to evaluate norms for
   //! \param[in] a The analytical stress field (optional)
-  ElasticityNorm(Elasticity& p, STensorFunc* a = 0);
-  //! \brief Empty destructor.
-  virtual ~ElasticityNorm() {}
+  //! \param[in] res If \e true, append the explicit residual error estimate
+  ElasticityNorm(Elasticity& p, STensorFunc* a = 0, bool res = false);
+  //! \brief The destructor stores the new point values in the caches.
+  virtual ~ElasticityNorm();
 
   //! \brief Returns whether this norm has explicit boundary contributions.
   virtual bool hasBoundaryTerms() const { return true; }
 
+  //! \brief Defines which FE quantities are needed by the integrand.
+  //! \details Second derivatives, the element corners and the interface
+  //! terms are added to the requirements of the problem integrand if the
+  //! residual estimate is wanted.
+  virtual int getIntegrandType() const;
+
   //! \brief Evaluates the integrand at an interior point.
   //! \param elmInt The local integral object to receive the contributions
   //! \param[in] fe Finite element data of current integration point
@@ -307,6 +468,14 @@ public:
   virtual bool evalInt(LocalIntegral& elmInt, const FiniteElement& fe,
                        const Vec3& X) const;
 
+  //! \brief Evaluates the integrand at an element interface point.
+  //! \param elmInt The local integral object to receive the contributions
+  //! \param[in] fe Finite element data of current integration point
+  //! \param[in] X Cartesian coordinates of current integration point
+  //! \param[in] normal Interface normal vector at current integration point
+  virtual bool evalInt(LocalIntegral& elmInt, const FiniteElement& fe,
+                       const Vec3& X, const Vec3& normal) const;
+
   //! \brief Evaluates the integrand at a boundary point.
   //! \param elmInt The local integral object to receive the contributions
   //! \param[in] fe Finite element data of current integration point
@@ -319,7 +488,9 @@ public:
   //! \brief Finalizes the element norms after the numerical integration.
   //! \param elmInt The local integral object to receive the contributions
   //!
-  //! \details This method is used to compute effectivity indices.
+  //! \details This method is used to compute effectivity indices, and to
+  //! store the element norms for deterministic summation, see
+  //! Elasticity::setElementNorms().
   virtual bool finalizeElement(LocalIntegral& elmInt);
 
   //! \brief Adds external energy terms to relevant norms.
@@ -342,7 +513,39 @@ public:
   virtual bool hasElementContributions(size_t i, size_t j) const;
 
 private:
-  STensorFunc* anasol; //!< Analytical stress field
+  //! \brief Evaluates the complementary energy product of a stress vector.
+  //! \param[in] s The stress vector
+  //! \param[in] Cinv The inverse constitutive matrix, or null if isotropic
+  //! \param[in] lambda Lame's first parameter (if isotropic)
+  //! \param[in] mu Lame's second parameter (if isotropic)
+  //! \param[in] planeStrain If \e true, the 2D stress is in plane strain
+  //! \return The product \f$\sigma^T C^{-1} \sigma\f$
+  //!
+  //! \details For isotropic materials, the product is evaluated in closed form
+  //! from the stress invariants, as \f$\frac{1}{2\mu}\left(\sigma:\sigma -
+  //! \frac{\lambda}{3\lambda+2\mu}(\mathrm{tr}\,\sigma)^2\right)\f$,
+  //! where the out-of-plane stress component is \f$\nu(s_{11}+s_{22})\f$
+  //! in plane strain and zero in plane stress.
+  static double energyProduct(const Vector& s, const Matrix* Cinv,
+                              double lambda, double mu, bool planeStrain);
+
+  STensorFunc*        anasol; //!< Analytical stress field
+  const STensorBatch* batch;  //!< Batch interface of the analytical field
+  AnaStressCache*     cache;  //!< Cache of analytical stress values
+  PointCache<LamePair>* lames; //!< Cache of Lame parameters
+
+  //! Element currently integrated by each thread
+  mutable std::vector<int> curElm;
+
+  //! \brief Parameters of an interface point.
+  typedef std::tuple<double,double,double> Params;
+  //! \brief Coordinates and FE traction of an interface point.
+  typedef std::pair<Vec3,Vec3> Traction;
+
+  //! FE tractions of the interface points visited from one side only
+  mutable std::multimap<Params,Traction> intfTrac;
+
+  bool residual; //!< If \e true, evaluate the explicit residual estimate
 };
 
 
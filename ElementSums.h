@@ -0,0 +1,65 @@
+// $Id$
+//==============================================================================
+//!
+//! \file ElementSums.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author IFEM team / SINTEF
+//!
+//! \brief Deterministic summation of element quantities.
+//!
+//==============================================================================
+
+#ifndef _ELEMENT_SUMS_H
+#define _ELEMENT_SUMS_H
+
+#include <vector>
+#include <cstddef>
+
+
+/*!
+  \brief Class for deterministic summation of element quantities.
+
+  \details The element values are stored in a table with one row per element,
+  which each element fills in without synchronization, since an element is
+  integrated by one thread only. The global sums are then computed from the
+  table in a fixed order, by pairwise summation of compensated block sums.
+  The result is therefore independent of the number of threads, and of the
+  order in which the elements are processed, in contrast to the accumulation
+  of the element contributions into a global sum as they are completed.
+*/
+
+class ElementSums
+{
+public:
+  //! \brief Default constructor.
+  ElementSums() : nComp(0) {}
+
+  //! \brief Allocates the table for the given number of elements.
+  //! \param[in] nel Number of elements (zero deallocates the table)
+  //! \param[in] ncmp Number of quantities per element
+  void resize(size_t nel, size_t ncmp);
+  //! \brief Returns \e true if no table is allocated.
+  bool empty() const { return values.empty(); }
+  //! \brief Returns the number of quantities per element.
+  size_t getNoComps() const { return nComp; }
+
+  //! \brief Assigns the quantities of an element.
+  //! \param[in] iel 1-based element index
+  //! \param[in] val Element values, only the first \a nComp values are used
+  //! \param[in] nval Number of element values
+  void assign(size_t iel, const double* val, size_t nval);
+
+  //! \brief Returns the global sum of quantity \a icmp over all elements.
+  double sum(size_t icmp) const;
+
+private:
+  //! \brief Sums the quantity \a icmp over the element range [i1,i2).
+  double sum(size_t icmp, size_t i1, size_t i2) const;
+
+  size_t              nComp;  //!< Number of quantities per element
+  std::vector<double> values; //!< Element quantities, element by element
+};
+
+#endif
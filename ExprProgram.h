@@ -0,0 +1,95 @@
+// $Id$
+//==============================================================================
+//!
+//! \file ExprProgram.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author IFEM team / SINTEF
+//!
+//! \brief Compiled evaluation of scalar function expressions.
+//!
+//==============================================================================
+
+#ifndef _EXPR_PROGRAM_H
+#define _EXPR_PROGRAM_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+
+/*!
+  \brief Class representing a compiled scalar expression in \a x,y,z and \a t.
+
+  \details The expression is given in the same syntax as the interpreted
+  expression functions, i.e., a sequence of statements separated by semicolons,
+  where all but the last statement are variable definitions on the form
+  <tt>name=expression</tt>. The value of the last statement is the result.
+
+  The expression is compiled into a flat stack-machine program, with constant
+  sub-expressions and variables with constant values folded at compile time.
+
+  Only a subset of the interpreted syntax is supported. The compile() method
+  returns \e false for expressions that are not, such that the caller may fall
+  back to the interpreted function in that case.
+*/
+
+class ExprProgram
+{
+public:
+  //! \brief Default constructor.
+  ExprProgram() : nVar(0), nStack(0) {}
+
+  //! \brief Compiles the given expression.
+  //! \param[in] expr The expression to compile
+  //! \param[in] prefix Optional variable definitions preceding the expression
+  //! \return \e false if the expression could not be compiled
+  bool compile(const std::string& expr, const std::string& prefix = "");
+
+  //! \brief Returns \e true if the program has been successfully compiled.
+  bool isCompiled() const { return !code.empty(); }
+  //! \brief Returns \e true if the program evaluates to a constant value.
+  bool isConstant() const;
+  //! \brief Returns \e true if the program depends on the time \a t.
+  bool dependsOnTime() const;
+
+  //! \brief Evaluates the program in a single point.
+  double evaluate(double x, double y = 0.0, double z = 0.0,
+                  double t = 0.0) const;
+
+private:
+  //! \brief Enum defining the program instructions.
+  enum OpCode { CONST, LOAD, STORE,
+                ADD, SUB, MUL, DIV, POW, NEG,
+                SIN, COS, TAN, ASIN, ACOS, ATAN, SINH, COSH, TANH,
+                EXP, LN, LOG10, SQRT, ABS, CEIL, FLOOR, IPART, FPART,
+                DEG, RAD, NOT,
+                ATAN2, MIN, MAX, MOD, LOGN, ABOVE, BELOW, EQUAL, AND, OR,
+                IF };
+
+  //! \brief Struct representing a program instruction.
+  struct Instruction
+  {
+    OpCode op;  //!< Operation code
+    int    var; //!< Variable index for the LOAD and STORE instructions
+    double val; //!< Constant value for the CONST instruction
+    //! \brief Constructor initializing the instruction.
+    Instruction(OpCode o, int i = 0, double v = 0.0) : op(o), var(i), val(v) {}
+  };
+
+  class Parser;
+
+  //! \brief Returns the number of arguments of an operation.
+  static int noArgs(OpCode op);
+  //! \brief Applies a unary operation on a value.
+  static double apply(OpCode op, double a);
+  //! \brief Applies a binary operation on two values.
+  static double apply(OpCode op, double a, double b);
+
+  std::vector<Instruction> code; //!< The compiled program
+  size_t nVar;   //!< Number of variables, including \a x, \a y, \a z and \a t
+  size_t nStack; //!< Maximum stack depth of the program
+};
+
+#endif
@@ -0,0 +1,65 @@
+// $Id$
+//==============================================================================
+//!
+//! \file HDF5NodalField.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author IFEM team / SINTEF
+//!
+//! \brief Input of nodal scalar fields from HDF5 result files.
+//!
+//==============================================================================
+
+#ifndef _HDF5_NODAL_FIELD_H
+#define _HDF5_NODAL_FIELD_H
+
+#include "MatVec.h"
+#include <string>
+
+class SIMbase;
+class TiXmlElement;
+
+
+/*!
+  \brief Class for reading nodal scalar fields from an HDF5 result file.
+
+  \details The field is assumed to be stored by another IFEM application on
+  the same mesh, i.e., as one dataset of nodal values for each patch, in the
+  group <tt>level/basis/fields/field/patch</tt>, where \a patch is the
+  global patch number and \a level is the absolute time level of the file,
+  i.e., not an offset from the first level. The nodal values of all
+  patches are assembled into a global vector, using the node numbering of
+  the current model, such that they can be interpolated element by element
+  using the basis function values at each integration point.
+*/
+
+class HDF5NodalField
+{
+public:
+  //! \brief Default constructor.
+  HDF5NodalField() : level0(0) {}
+
+  //! \brief Parses the field definition from an XML-element.
+  bool parse(const TiXmlElement* elem);
+
+  //! \brief Returns the absolute time level of the first step.
+  int getFirstLevel() const { return level0; }
+
+  //! \brief Reads the nodal field values at the given time level.
+  //! \param[in] model The FE model the field is defined on
+  //! \param[in] level The absolute time level to read
+  //! \param[out] values Nodal field values in global node order
+  bool read(const SIMbase& model, int level, Vector& values) const;
+
+  //! \brief Prints out the field definition to the log stream.
+  void printLog() const;
+
+private:
+  std::string file;  //!< Name of the HDF5 file
+  std::string field; //!< Name of the field
+  std::string basis; //!< Name of the basis the field is stored on
+  int         level0; //!< Time level corresponding to the first step
+};
+
+#endif
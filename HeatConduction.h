@@ -0,0 +1,111 @@
+// $Id$
+//==============================================================================
+//!
+//! \file HeatConduction.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author IFEM team / SINTEF
+//!
+//! \brief Integrand implementations for heat conduction problems.
+//!
+//==============================================================================
+
+#ifndef _HEAT_CONDUCTION_H
+#define _HEAT_CONDUCTION_H
+
+#include "IntegrandBase.h"
+
+class Material;
+
+
+/*!
+  \brief Class representing the integrand of the heat conduction problem.
+  \details The steady or transient heat equation,
+  \f$\rho c\dot{T} - \nabla\cdot(k\nabla T) = q\f$, is discretized in time by
+  the backward Euler scheme. The conductivity \a k and heat capacity \a c are
+  obtained from the material model of the elasticity problem, and are evaluated
+  at the temperature of the previous time step. The integrand therefore uses
+  the same material objects as the thermo-elastic stress analysis.
+*/
+
+class HeatConduction : public IntegrandBase
+{
+public:
+  //! \brief The constructor initializes all pointers to zero.
+  //! \param[in] n Number of spatial dimensions
+  HeatConduction(unsigned short int n);
+  //! \brief The destructor frees the heat source field.
+  virtual ~HeatConduction();
+
+  //! \brief Prints out the problem definition to the log stream.
+  virtual void printLog() const;
+
+  //! \brief Defines the solution mode before the element assembly is started.
+  //! \param[in] mode The solution mode to use
+  virtual void setMode(SIM::SolutionMode mode);
+
+  //! \brief Defines the material properties.
+  void setMaterial(const Material* mat) { material = mat; }
+  //! \brief Defines the heat source field.
+  //! \details The integrand takes over the ownership of the field.
+  void setSource(RealFunc* src);
+  //! \brief Defines the heat flux field to use in Neumann conditions.
+  //! \details The field is owned by the simulator, not by the integrand.
+  void setFlux(RealFunc* flx) { fluxFld = flx; }
+  //! \brief Defines the time step size.
+  //! \details A zero time step size gives a steady state analysis.
+  void setTimeStep(double dt) { timeStep = dt; }
+
+  using IntegrandBase::getLocalIntegral;
+  //! \brief Returns a local integral container for the given element.
+  //! \param[in] nen Number of nodes on element
+  //! \param[in] neumann Whether or not we are assembling Neumann BC's
+  virtual LocalIntegral* getLocalIntegral(size_t nen, size_t,
+                                          bool neumann) const;
+
+  using IntegrandBase::evalInt;
+  //! \brief Evaluates the integrand at an interior point.
+  //! \param elmInt The local integral object to receive the contributions
+  //! \param[in] fe Finite element data of current integration point
+  //! \param[in] X Cartesian coordinates of current integration point
+  virtual bool evalInt(LocalIntegral& elmInt, const FiniteElement& fe,
+                       const Vec3& X) const;
+
+  using IntegrandBase::evalBou;
+  //! \brief Evaluates the integrand at a boundary point.
+  //! \param elmInt The local integral object to receive the contributions
+  //! \param[in] fe Finite element data of current integration point
+  //! \param[in] X Cartesian coordinates of current integration point
+  //! \param[in] normal Boundary normal vector at current integration point
+  virtual bool evalBou(LocalIntegral& elmInt, const FiniteElement& fe,
+                       const Vec3& X, const Vec3& normal) const;
+
+  using IntegrandBase::evalSol;
+  //! \brief Evaluates the heat flux at a result point.
+  //! \param[out] s The heat flux vector at current point
+  //! \param[in] fe Finite element data at current point
+  //! \param[in] X Cartesian coordinates of current point
+  //! \param[in] MNPC Nodal point correspondance for the basis function values
+  virtual bool evalSol(Vector& s, const FiniteElement& fe, const Vec3& X,
+                       const std::vector<int>& MNPC) const;
+
+  //! \brief Returns the number of primary/secondary solution field components.
+  //! \param[in] fld which field set to consider (1=primary, 2=secondary)
+  virtual size_t getNoFields(int fld = 2) const { return fld > 1 ? nsd : 1; }
+  //! \brief Returns the name of the primary solution field.
+  //! \param[in] prefix Name prefix
+  virtual std::string getField1Name(size_t, const char* prefix = 0) const;
+  //! \brief Returns the name of a secondary solution field component.
+  //! \param[in] i Field component index
+  //! \param[in] prefix Name prefix for all components
+  virtual std::string getField2Name(size_t i, const char* prefix = 0) const;
+
+private:
+  const Material* material; //!< Material data
+  RealFunc*       heatSrc;  //!< Pointer to the heat source field (owned)
+  RealFunc*       fluxFld;  //!< Pointer to the boundary heat flux field
+  double          timeStep; //!< Time step size (zero for steady state)
+};
+
+#endif
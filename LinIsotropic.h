@@ -17,6 +17,9 @@
 #include "MaterialBase.h"
 #include "Function.h"
 #include "Field.h"
+#include "Vec3.h"
+
+class VoxelGrid;
 
 
 /*!
@@ -38,8 +41,11 @@ public:
   //! \param[in] ax If \e true, assume 3D axi-symmetric material
   LinIsotropic(double E, double v = 0.0, double densty = 0.0,
                bool ps = false, bool ax = false)
-    : Efunc(nullptr), Efield(nullptr), Emod(E), nu(v), rho(densty),
-      Afunc(nullptr), alpha(0.0), planeStress(ps), axiSymmetry(ax) {}
+    : Efunc(nullptr), Efield(nullptr), Evox(nullptr),
+      Emod(E), nu(v), rho(densty),
+      Afunc(nullptr), alpha(0.0), planeStress(ps), axiSymmetry(ax),
+      useTab(false), inputError(false)
+  { this->initConstMatrices(); }
   //! \brief Constructor initializing the material parameters.
   //! \param[in] E Young's modulus (spatial function)
   //! \param[in] v Poisson's ratio
@@ -57,10 +63,12 @@ public:
   LinIsotropic(Field* E, double v = 0.0, double density = 0.0,
                bool ps = false, bool ax = false);
   //! \brief The destructor deletes the stiffness function, if defined.
-  virtual ~LinIsotropic() { delete Efunc; delete Efield; delete Afunc; }
+  virtual ~LinIsotropic();
 
   //! \brief Parses material parementers from an XML element.
   virtual void parse(const TiXmlElement* elem);
+  //! \brief Returns \e true if the parsed material definition was invalid.
+  bool hasInputError() const { return inputError; }
 
   //! \brief Prints out material parameters to the log stream.
   virtual void printLog() const;
@@ -68,6 +76,22 @@ public:
   //! \brief Returns \e false if plane stress in 2D.
   virtual bool isPlaneStrain() const { return !planeStress; }
 
+  //! \brief Initializes the tabulated stiffness at the integration points.
+  //! \param[in] nGP Total number of integration points in the model
+  virtual void initTables(size_t nGP);
+  //! \brief Enables or disables the use of the tabulated stiffness.
+  //! \param[in] enable If \e true, the current pass assembles the system
+  //! matrices, with a unique interior integration point index \a fe.iGP
+  virtual void useTables(bool enable) { useTab = enable; }
+
+  //! \brief Returns \e true if the material properties are spatially constant.
+  virtual bool isConstant() const { return !Efunc && !Efield && !Evox; }
+  //! \brief Returns the precomputed (inverse) constitutive matrix, if any.
+  //! \param[in] nsd Number of spatial dimensions
+  //! \param[in] inverse If \e true, return the inverse constitutive matrix
+  virtual const Matrix* getConstitutiveMatrix(size_t nsd,
+                                              bool inverse = false) const;
+
   //! \brief Evaluates the stiffness at current point.
   virtual double getStiffness(const Vec3& X) const;
   //! \brief Evaluates the mass density at current point.
@@ -97,6 +121,21 @@ public:
                         char iop = 1, const TimeDomain* = nullptr,
                         const Tensor* = nullptr) const;
 
+  //! \brief Evaluates the constitutive relation at a set of points.
+  //! \param[out] C Constitutive matrices at the points
+  //! \param[out] sigma Stress tensors at the points
+  //! \param[out] U Strain energy densities at the points
+  //! \param[in] fe Finite element quantities at the points
+  //! \param[in] X Cartesian coordinates of the points
+  //! \param[in] eps Strain tensors at the points
+  //! \param[in] iop Calculation option
+  virtual bool evaluate(std::vector<Matrix>& C, std::vector<SymmTensor>& sigma,
+                        std::vector<double>& U,
+                        const std::vector<const FiniteElement*>& fe,
+                        const std::vector<Vec3>& X,
+                        const std::vector<SymmTensor>& eps,
+                        char iop = 1, const TimeDomain* = nullptr) const;
+
   //! \brief Evaluates the Lame-parameters at an integration point.
   //! \param[out] lambda Lame's first parameter
   //! \param[out] mu Lame's second parameter (shear modulus)
@@ -111,9 +150,34 @@ public:
   const Field* getEfield() const { return Efield; }
 
 protected:
+  //! \brief Forms the (inverse) constitutive matrix for a given stiffness.
+  //! \param[out] C The constitutive matrix
+  //! \param[in] E Young's modulus
+  //! \param[in] nsd Number of spatial dimensions
+  //! \param[in] inverse If \e true, form the inverse constitutive matrix
+  bool formCmatrix(Matrix& C, double E, size_t nsd, bool inverse) const;
+  //! \brief Calculates the stress tensor from the strain tensor.
+  //! \param[in] C The constitutive matrix
+  //! \param[out] sigma The stress tensor
+  //! \param[in] eps The strain tensor
+  bool formStress(const Matrix& C, SymmTensor& sigma,
+                  const SymmTensor& eps) const;
+  //! \brief Evaluates the Young's modulus at current point.
+  //! \param[in] fe Finite element quantities at current point
+  //! \param[in] X Cartesian coordinates of current point
+  //!
+  //! \details If the stiffness is given as a spatial function or field,
+  //! it is evaluated only once for each integration point, and then
+  //! looked up in \a Etab on subsequent calls for the same point.
+  double getEmod(const FiniteElement& fe, const Vec3& X) const;
+
+  //! \brief Precomputes the constitutive matrices if the stiffness is constant.
+  void initConstMatrices();
+
   // Material properties
   RealFunc* Efunc;      //!< Young's modulus (spatial function)
   Field* Efield;        //!< Young's modulus (spatial field)
+  VoxelGrid* Evox;      //!< Young's modulus (voxel grid)
   double Emod;          //!< Young's modulus (constant)
   double nu;            //!< Poisson's ratio
   double rho;           //!< Mass density
@@ -125,6 +189,15 @@ protected:
   double conductivity;  //!< Thermal conductivity (constant)
   bool   planeStress;   //!< Plane stress/strain option for 2D problems
   bool   axiSymmetry;   //!< Axi-symmetric option
+
+  mutable RealArray Etab; //!< Tabulated Young's modulus at integration points
+  bool useTab; //!< If \e true, the table is used in the current pass
+
+  bool inputError; //!< If \e true, the parsed definition was invalid
+
+  //! Precomputed constitutive matrices for spatially constant stiffness,
+  //! index 2*(nsd-1) is the matrix itself and 2*nsd-1 is its inverse
+  Matrix Cconst[6];
 };
 
 #endif
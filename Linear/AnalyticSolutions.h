@@ -17,21 +17,25 @@
 #include "Function.h"
 #include "Tensor.h"
 #include "AnaSol.h"
+#include "StressBatch.h"
 
 
 /*!
   \brief Analytic solution for an infinite plate with a hole.
 */
 
-class Hole : public STensorFunc
+class Hole : public STensorFunc, public STensorBatch
 {
 public:
   //! \brief Constructor with some default parameters.
   Hole(double r = 1.0, double f = 1.0, double P = 0.3, bool use3D = false)
-    : a(r), F0(f), nu(P), is3D(use3D) {}
+    : STensorBatch(use3D ? 3 : 2, true), a(r), F0(f), nu(P), is3D(use3D) {}
   //! \brief Empty destructor.
   virtual ~Hole() {}
 
+  //! \brief Evaluates the analytic stress tensor at a batch of points.
+  virtual void evaluate(const StressBatch& b) const;
+
 protected:
   //! \brief Evaluates the analytic stress tensor at the point \a x.
   virtual SymmTensor evaluate(const Vec3& x) const;
@@ -48,7 +52,7 @@ private:
   \brief Analytic solution for the L-shaped domain.
 */
 
-class Lshape : public STensorFunc
+class Lshape : public STensorFunc, public STensorBatch
 {
 public:
   //! \brief Constructor with some default parameters.
@@ -56,6 +60,9 @@ public:
   //! \brief Empty destructor.
   virtual ~Lshape() {}
 
+  //! \brief Evaluates the analytic stress tensor at a batch of points.
+  virtual void evaluate(const StressBatch& b) const;
+
 protected:
   //! \brief Evaluates the analytic stress tensor at the point \a x.
   virtual SymmTensor evaluate(const Vec3& x) const;
@@ -74,15 +81,18 @@ private:
   \brief Analytic solution for the cantilever beam with a tip shear load.
 */
 
-class CanTS : public STensorFunc
+class CanTS : public STensorFunc, public STensorBatch
 {
 public:
   //! \brief Constructor with some default parameters.
   CanTS(double l, double h, double f = 1.0, bool use3D = false)
-    : L(l), H(h), F0(f), is3D(use3D) {}
+    : STensorBatch(use3D ? 3 : 2, false), L(l), H(h), F0(f), is3D(use3D) {}
   //! \brief Empty destructor.
   virtual ~CanTS() {}
 
+  //! \brief Evaluates the analytic stress tensor at a batch of points.
+  virtual void evaluate(const StressBatch& b) const;
+
 protected:
   //! \brief Evaluates the analytic stress tensor at the point \a x.
   virtual SymmTensor evaluate(const Vec3& x) const;
@@ -99,15 +109,18 @@ private:
   \brief Analytic solution for the cantilever beam with a tip moment load.
 */
 
-class CanTM : public STensorFunc
+class CanTM : public STensorFunc, public STensorBatch
 {
 public:
   //! \brief Constructor with some default parameters.
   CanTM(double h, double m = 1.0, bool use3D = false)
-    : H(h), M0(m), is3D(use3D) {}
+    : STensorBatch(use3D ? 3 : 2, false), H(h), M0(m), is3D(use3D) {}
   //! \brief Empty destructor.
   virtual ~CanTM() {}
 
+  //! \brief Evaluates the analytic stress tensor at a batch of points.
+  virtual void evaluate(const StressBatch& b) const;
+
 protected:
   //! \brief Evaluates the analytic stress tensor at the point \a x.
   virtual SymmTensor evaluate(const Vec3& x) const;
@@ -123,7 +136,7 @@ private:
   \brief Analytic solution for the curved beam with end shear.
 */
 
-class CurvedBeam : public STensorFunc
+class CurvedBeam : public STensorFunc, public STensorBatch
 {
 public:
   //! \brief Constructor with some default parameters.
@@ -132,6 +145,9 @@ public:
   //! \brief Empty destructor.
   virtual ~CurvedBeam() {}
 
+  //! \brief Evaluates the analytic stress tensor at a batch of points.
+  virtual void evaluate(const StressBatch& b) const;
+
 protected:
   //! \brief Evaluates the analytic stress tensor at the point \a x.
   virtual SymmTensor evaluate(const Vec3& x) const;
@@ -148,7 +164,7 @@ private:
   \brief Analytic solution for a cylindric pipe with temperature gradient.
 */
 
-class Pipe : public STensorFunc
+class Pipe : public STensorFunc, public STensorBatch
 {
 public:
   //! \brief Constructor with some default parameters.
@@ -158,6 +174,9 @@ public:
   //! \brief Empty destructor.
   virtual ~Pipe() {}
 
+  //! \brief Evaluates the analytic stress tensor at a batch of points.
+  virtual void evaluate(const StressBatch& b) const;
+
 protected:
   //! \brief Evaluates the analytic stress tensor at the point \a x.
   virtual SymmTensor evaluate(const Vec3& x) const;
@@ -218,9 +237,9 @@ class NavierPlate : public ThinPlateSol, private STensorFunc
   public:
     //! \brief The constructor initializes the member references.
     Displ(double& p, double& d, double& a, double& b, double& x, double& y,
-	  double& cc, double& dd, char& t, int& i) :
+	  double& cc, double& dd, char& t, int& i, std::vector<double>& c) :
       pz(p), D(d), alpha(a), beta(b), xi(x), eta(y), c2(cc), d2(dd),
-      type(t), inc(i) {}
+      type(t), inc(i), coef(c) {}
     //! \brief Empty destructor.
     virtual ~Displ() {}
 
@@ -240,6 +259,8 @@ class NavierPlate : public ThinPlateSol, private STensorFunc
     double& d2;   //!< Partial load extension in Y-direction
     char&   type; //!< Load type parameter (0, 1, or 2)
     int&    inc;  //!< Increment in Fourier term summation (1 or 2)
+
+    std::vector<double>& coef; //!< Load coefficients of the Fourier terms
   };
 
 public:
@@ -256,7 +277,29 @@ protected:
   virtual SymmTensor evaluate(const Vec3& x) const;
 
   //! \brief Adds the m'th and n'th terms of the plate solution to the moments.
-  void addTerms(std::vector<double>& M, double x, double y, int m, int n) const;
+  //! \param M The moment tensor components to add the terms to
+  //! \param[in] sx Tabulated values of sin(alpha*m*x)
+  //! \param[in] cx Tabulated values of cos(alpha*m*x)
+  //! \param[in] sy Tabulated values of sin(beta*n*y)
+  //! \param[in] cy Tabulated values of cos(beta*n*y)
+  //! \param[in] m Fourier term index in x-direction
+  //! \param[in] n Fourier term index in y-direction
+  void addTerms(std::vector<double>& M, const double* sx, const double* cx,
+                const double* sy, const double* cy, int m, int n) const;
+
+  //! \brief Computes the load coefficients of all Fourier terms.
+  //! \details The coefficients depend on the load only, and not on the
+  //! evaluation point, so they are computed once in the constructors.
+  void initCoefficients();
+
+  //! \brief Tabulates the 1D trigonometric functions at a point.
+  //! \param[in] x The coordinate to evaluate at
+  //! \param[in] a The wave number of the first term
+  //! \param[out] s Values of sin(a*m*x), m = 1...max_mn
+  //! \param[out] c Values of cos(a*m*x), m = 1...max_mn (optional)
+  static void tabulate(double x, double a, double* s, double* c = nullptr);
+
+  static const int max_mn = 100; //!< Maximum number of Fourier terms
 
 private:
   Displ  w; //!< The analytical displacement field
@@ -271,6 +314,8 @@ private:
   double c2;   //!< Partial load extension in X-direction
   double d2;   //!< Partial load extension in Y-direction
   int    inc;  //!< Increment in Fourier term summation (1 or 2)
+
+  std::vector<double> coef; //!< Load coefficients of the Fourier terms
 };
 
 #endif
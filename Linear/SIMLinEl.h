@@ -28,7 +28,9 @@ template<class Dim> class SIMLinEl : public SIMElasticity<Dim>
 public:
   //! \brief Default constructor.
   //! \param[in] checkRHS If \e true, ensure the model is in a right-hand system
-  SIMLinEl(bool checkRHS = false) : SIMElasticity<Dim>(checkRHS) {}
+  //! \param[in] lumped If \e true, also estimate the error by lumped recovery
+  SIMLinEl(bool checkRHS = false, bool lumped = false)
+    : SIMElasticity<Dim>(checkRHS,lumped) {}
   //! \brief Empty destructor.
   virtual ~SIMLinEl() {}
 
@@ -16,6 +16,9 @@
 
 #include "Elasticity.h"
 
+class HDF5NodalField;
+class ASMbase;
+
 
 /*!
   \brief Class representing the integrand of the linear elasticity problem.
@@ -32,8 +35,8 @@ public:
   //! \param[in] axS \e If \e true, an axisymmetric 3D formulation is assumed
   //! \param[in] GPout \e If -e true, write Gauss point coordinates to VTF
   LinearElasticity(unsigned short int n, bool axS = false, bool GPout = false);
-  //! \brief Empty destructor.
-  virtual ~LinearElasticity() {}
+  //! \brief The destructor deletes the temperature field input definition.
+  virtual ~LinearElasticity();
 
   //! \brief Parses a data section from an XML element.
   virtual bool parse(const TiXmlElement* elem);
@@ -47,6 +50,16 @@ public:
   //! \param[in] nBp Total number of boundary integration points
   virtual void initIntegration(size_t nGp, size_t nBp);
 
+  using Elasticity::initElement;
+  //! \brief Initializes current element for numerical integration.
+  //! \param[in] MNPC Matrix of nodal point correspondance for current element
+  //! \param elmInt Local integral for element
+  //!
+  //! \details Reimplemented to also extract the element temperatures,
+  //! if a nodal temperature field has been assigned. They are then stored as
+  //! the last element vector in \a elmInt.
+  virtual bool initElement(const std::vector<int>& MNPC, LocalIntegral& elmInt);
+
   //! \brief Returns whether there are any traction values to write to VTF.
   virtual bool hasTractionValues() const;
   //! \brief Writes the surface tractions for a given time step to VTF-file.
@@ -79,6 +92,15 @@ public:
   virtual bool evalBou(LocalIntegral& elmInt, const FiniteElement& fe,
                        const Vec3& X, const Vec3& normal) const;
 
+  using Elasticity::evalSol;
+  //! \brief Evaluates the secondary solution at a result point.
+  //! \param[out] s The solution field values at current point
+  //! \param[in] fe Finite element data at current point
+  //! \param[in] X Cartesian coordinates of current point
+  //! \param[in] MNPC Nodal point correspondance for the basis function values
+  virtual bool evalSol(Vector& s, const FiniteElement& fe, const Vec3& X,
+                       const std::vector<int>& MNPC) const;
+
   //! \brief Returns which integrand to be used.
   virtual int getIntegrandType() const;
 
@@ -86,11 +108,30 @@ public:
   const RealFunc* getInitialTemperature() const { return myTemp0; }
   //! \brief Returns the stationary temperature field.
   const RealFunc* getTemperature() const { return myTemp; }
+  //! \brief Returns the nodal temperature field input definition, if any.
+  const HDF5NodalField* getTemperatureInput() const { return myTempInp; }
+
+  //! \brief Assigns the nodal temperature field.
+  //! \param[in] T Nodal temperatures, in global node order
+  //! \details When assigned, the temperature at each integration point is
+  //! interpolated from the element nodal values, instead of being evaluated
+  //! from the explicit temperature function.
+  void setTemperature(const Vector& T) { myTempNod = T; }
+  //! \brief Extracts the nodal temperatures of a patch.
+  //! \param[in] pch The patch to extract the temperatures for
+  //! \details This is to be invoked before the integration of each patch,
+  //! since the element temperatures are extracted using the patch-local node
+  //! numbers of the elements.
+  void initPatchTemperature(const ASMbase& pch);
+  //! \brief Returns \e true if a temperature field has been assigned.
+  bool haveTemperature() const { return myTemp || !myTempNod.empty(); }
 
 protected:
   //! \brief Evaluates the thermal strain at current integration point.
+  //! \param[in] eT Element nodal temperatures, if any
+  //! \param[in] N Basis function values at current integration point
   //! \param[in] X Cartesian coordinates of current integration point
-  virtual double getThermalStrain(const Vector&, const Vector&,
+  virtual double getThermalStrain(const Vector& eT, const Vector& N,
                                   const Vec3& X) const;
 
   //! \brief Calculates integration point initial strain force contributions.
@@ -104,8 +145,11 @@ protected:
                                     const Matrix& B, const Matrix& C,
                                     const Vec3& X, double detJW) const;
 
-  RealFunc* myTemp0; //!< Initial temperature field
-  RealFunc* myTemp;  //!< Explicit stationary temperature field
+  RealFunc*       myTemp0;   //!< Initial temperature field
+  RealFunc*       myTemp;    //!< Explicit stationary temperature field
+  Vector          myTempNod; //!< Nodal temperature field
+  Vector          myTempPch; //!< Nodal temperatures of current patch
+  HDF5NodalField* myTempInp; //!< Nodal temperature field input definition
 
 private:
   mutable Vec3Vec* myItgPts; //!< Global Gauss point coordinates
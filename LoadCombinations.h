@@ -0,0 +1,145 @@
+// $Id$
+//==============================================================================
+//!
+//! \file LoadCombinations.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author IFEM team / SINTEF
+//!
+//! \brief Superposition of load cases of linear elastic static simulations.
+//!
+//==============================================================================
+
+#ifndef _LOAD_COMBINATIONS_H
+#define _LOAD_COMBINATIONS_H
+
+#include "IntegrandBase.h"
+#include "GlobalIntegral.h"
+#include "MatVec.h"
+#include "Vec3.h"
+
+class SIMbase;
+class ASMbase;
+class Elasticity;
+struct LoadCombination;
+
+
+/*!
+  \brief Class for evaluation of load combinations by linear superposition.
+
+  \details The result points are the interior integration points of the
+  model, restricted to the region of interest, if any. They are recorded in
+  one pass over the elements, storing only what the stress evaluation needs,
+  i.e., the element number, the parameters, the basis function values and
+  derivatives and the coordinates of each point. The global node numbers are
+  stored once per element. The stress tensor of each unit load case is then
+  evaluated once at every point and stored, element by element, with one
+  call to the batched constitutive relation for all points of an element.
+
+  A load combination is a linear combination of the unit load cases, so its
+  stresses are obtained as the factored sum of the stored stress tensors,
+  without any solution or integration. For each point, the envelopes of the
+  von Mises stress and of the largest principal stress over all combinations
+  are computed, along with the governing combination. The volume loads, such
+  as gravity, are included only in the load cases flagged with them, which
+  is the first load case by default. They are therefore scaled by the factor
+  of that load case, as any other load.
+*/
+
+class LoadCombinations : public IntegrandBase, public GlobalIntegral
+{
+public:
+  //! \brief The constructor binds the superposition to a problem.
+  //! \param[in] p The linear elasticity problem to superpose the results of
+  LoadCombinations(Elasticity& p);
+  //! \brief Empty destructor.
+  virtual ~LoadCombinations() {}
+
+  //! \brief Records the result points of the model.
+  //! \param[in] model The FE model to record the result points for
+  bool init(const SIMbase& model);
+
+  //! \brief Evaluates and stores the stresses of a unit load case.
+  //! \param[in] psol Primary solution vector of the load case
+  bool addLoadCase(const Vector& psol);
+  //! \brief Returns the number of stored load cases.
+  size_t getNoLoadCases() const { return caseStress.size(); }
+
+  //! \brief Evaluates the envelopes of a set of load combinations.
+  //! \param[in] combs The load combinations to evaluate
+  bool evaluate(const std::vector<LoadCombination>& combs);
+
+  //! \brief Prints the maximum values of the envelopes to the log stream.
+  void printEnvelope() const;
+
+  //! \brief Returns the number of result points.
+  size_t getNoPoints() const { return points.size(); }
+  //! \brief Returns the coordinates of a result point.
+  const Vec3& getPoint(size_t ip) const { return points[ip].X; }
+  //! \brief Returns the von Mises stress envelope, point by point.
+  const RealArray& getVonMisesEnvelope() const { return maxVM; }
+  //! \brief Returns the maximum principal stress envelope, point by point.
+  const RealArray& getPrincipalEnvelope() const { return maxP1; }
+
+  using IntegrandBase::getLocalIntegral;
+  //! \brief Returns a local integral container for the given element.
+  //! \param[in] nen Number of nodes on element
+  virtual LocalIntegral* getLocalIntegral(size_t nen, size_t, bool) const;
+
+  using IntegrandBase::initElement;
+  //! \brief Initializes current element for numerical integration.
+  //! \param[in] MNPC Matrix of nodal point correspondance for current element
+  //! \param elmInt Local integral for element
+  virtual bool initElement(const std::vector<int>& MNPC,
+                           LocalIntegral& elmInt);
+
+  using IntegrandBase::evalInt;
+  //! \brief Records an interior integration point.
+  //! \param elmInt The local integral object of current element
+  //! \param[in] fe Finite element data of current integration point
+  //! \param[in] X Cartesian coordinates of current integration point
+  virtual bool evalInt(LocalIntegral& elmInt, const FiniteElement& fe,
+                       const Vec3& X) const;
+
+  //! \brief Nothing to assemble, the points are recorded by \a evalInt.
+  virtual bool assemble(const LocalIntegral*, int) { return true; }
+
+private:
+  //! \brief Data of a recorded result point.
+  struct ResultPoint
+  {
+    int    iel;   //!< Global element number
+    double u;     //!< First parameter of the point
+    double v;     //!< Second parameter of the point
+    double w;     //!< Third parameter of the point
+    Vector N;     //!< Basis function values
+    Matrix dNdX;  //!< Basis function derivatives
+    Vec3   X;     //!< Cartesian coordinates of the point
+  };
+
+  //! \brief Returns \e true if point \a a is to be stored before point \a b.
+  static bool before(const ResultPoint& a, const ResultPoint& b);
+
+  Elasticity&    myProblem; //!< The problem to superpose the results of
+  const ASMbase* myPatch;   //!< The patch currently being recorded
+  size_t         nStress;   //!< Number of stress components at each point
+
+  std::vector<ResultPoint> points; //!< The recorded result points
+  std::vector<size_t> elmStart; //!< Index of the first point of each element
+  //! Global node numbers of each element, indexed by element number
+  std::vector< std::vector<int> > elmNodes;
+  //! Points recorded by each thread, merged into \a points after the pass
+  mutable std::vector< std::vector<ResultPoint> > newPoints;
+
+  std::vector<RealArray> caseStress; //!< Stresses of each unit load case
+
+  std::vector<std::string> names; //!< Names of the evaluated combinations
+
+  RealArray        maxVM;  //!< Von Mises stress envelope
+  RealArray        maxP1;  //!< Maximum principal stress envelope
+  std::vector<int> vmComb; //!< Governing combination of the von Mises stress
+  std::vector<int> p1Comb; //!< Governing combination of the principal stress
+};
+
+#endif
@@ -0,0 +1,101 @@
+// $Id$
+//==============================================================================
+//!
+//! \file LumpedRecovery.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author IFEM team / SINTEF
+//!
+//! \brief Local recovery of secondary solutions by lumped L2-projection.
+//!
+//==============================================================================
+
+#ifndef _LUMPED_RECOVERY_H
+#define _LUMPED_RECOVERY_H
+
+#include "IntegrandBase.h"
+#include "GlobalIntegral.h"
+
+class SIMbase;
+class ASMbase;
+
+
+/*!
+  \brief Class for local recovery of the secondary solution of a problem.
+
+  \details The recovered nodal values are computed by a lumped L2-projection,
+  \f$\sigma^r_A = \int N_A\sigma^h\,d\Omega / \int N_A\,d\Omega\f$,
+  i.e., the consistent projection matrix is replaced by its row sums.
+  Since the basis functions are non-negative and form a partition of unity,
+  this is a weighted average of the FE solution over the support of each
+  basis function. No equation system is assembled or solved, so the cost is
+  that of one element loop, which runs in parallel without synchronization.
+
+  The secondary solution is evaluated by the \a evalSol method of the
+  associated problem integrand, using the current primary solution of the
+  problem. The recovered solution is stored node by node, in the same format
+  as the projected solutions of SIMbase::project, such that it can be used in
+  the error estimates of the norm integrand of the problem.
+*/
+
+class LumpedRecovery : public IntegrandBase, public GlobalIntegral
+{
+public:
+  //! \brief The constructor binds the recovery to a problem integrand.
+  //! \param[in] p The problem whose secondary solution is to be recovered
+  LumpedRecovery(IntegrandBase& p);
+  //! \brief Empty destructor.
+  virtual ~LumpedRecovery() {}
+
+  //! \brief Recovers the secondary solution of the problem.
+  //! \param[out] sr Recovered secondary solution, node by node
+  //! \param[in] model The FE model to recover the solution for
+  //! \param[in] psol Primary solution vector
+  bool recover(Vector& sr, const SIMbase& model, const Vector& psol);
+
+  //! \brief Restricts the recovery to a subset of the elements.
+  //! \param[in] elms Element flags, one for each element of the model
+  //! \details The elements outside the subset are skipped, such that the
+  //! nodes on the boundary of the subset are averaged over the elements
+  //! inside only, and the nodes outside get zero values.
+  void setElements(const std::vector<bool>& elms) { elmSet = elms; }
+
+  using IntegrandBase::getLocalIntegral;
+  //! \brief Returns a local integral container for the given element.
+  //! \param[in] nen Number of nodes on element
+  virtual LocalIntegral* getLocalIntegral(size_t nen, size_t, bool) const;
+
+  using IntegrandBase::initElement;
+  //! \brief Initializes current element for numerical integration.
+  //! \param[in] MNPC Matrix of nodal point correspondance for current element
+  //! \param elmInt Local integral for element
+  virtual bool initElement(const std::vector<int>& MNPC,
+                           LocalIntegral& elmInt);
+
+  using IntegrandBase::evalInt;
+  //! \brief Evaluates the integrand at an interior point.
+  //! \param elmInt The local integral object to receive the contributions
+  //! \param[in] fe Finite element data of current integration point
+  //! \param[in] X Cartesian coordinates of current integration point
+  virtual bool evalInt(LocalIntegral& elmInt, const FiniteElement& fe,
+                       const Vec3& X) const;
+
+  //! \brief Adds the element contributions to the nodal sums.
+  //! \param[in] elmObj Pointer to the element contributions
+  //! \details Elements processed concurrently by different threads never
+  //! share nodes, due to the thread partitioning of the patches.
+  virtual bool assemble(const LocalIntegral* elmObj, int);
+
+private:
+  IntegrandBase& myProblem; //!< The problem to recover the solution for
+  const ASMbase* myPatch;   //!< The patch currently being integrated
+  size_t         nrcmp;     //!< Number of secondary solution components
+
+  std::vector<bool> elmSet; //!< Elements to recover from (empty means all)
+
+  Vector values;  //!< Weighted nodal sums of the secondary solution
+  Vector weights; //!< Nodal sums of the basis function integrals
+};
+
+#endif
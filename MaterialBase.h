@@ -50,6 +50,13 @@ public:
 
   //! \brief Initializes the material with the number of integration points.
   virtual void initIntegration(size_t) {}
+  //! \brief Initializes tabulated material properties at integration points.
+  //! \details This method may be invoked several times with the same number
+  //! of points and should then leave the tables unchanged. Unlike
+  //! initIntegration(size_t), it must not reset any history variables.
+  virtual void initTables(size_t) {}
+  //! \brief Enables or disables the use of tabulated material properties.
+  virtual void useTables(bool) {}
   //! \brief Initializes the material model for a new integration loop.
   virtual void initIntegration(const TimeDomain&) {}
   //! \brief Initializes the material model for a new result point loop.
@@ -59,6 +66,16 @@ public:
   //! \brief Assigns a scalar field defining the material properties.
   virtual void assignScalarField(Field*, size_t = 0) {}
 
+  //! \brief Returns \e true if the material properties are spatially constant.
+  virtual bool isConstant() const { return false; }
+  //! \brief Returns a precomputed (inverse) constitutive matrix, if available.
+  //! \details Materials with spatially constant properties may reimplement
+  //! this method to return a matrix that is formed once for the given number
+  //! of spatial dimensions, such that the integrands can use it directly
+  //! instead of invoking evaluate() at every integration point.
+  virtual const Matrix* getConstitutiveMatrix(size_t, bool = false) const
+  { return nullptr; }
+
   //! \brief Evaluates the stiffness at current point.
   virtual double getStiffness(const Vec3&) const { return 1.0; }
   //! \brief Evaluates the mass density at current point.
@@ -92,6 +109,33 @@ public:
                         char iop = 1, const TimeDomain* prm = nullptr,
                         const Tensor* Fpf = nullptr) const = 0;
 
+  //! \brief Evaluates the constitutive relation at a set of points.
+  //! \param[out] C Constitutive matrices at the points. If the matrix is the
+  //! same in all points, only one matrix may be returned, otherwise one matrix
+  //! per point is returned.
+  //! \param[out] sigma Stress tensors at the points (for \a iop > 0)
+  //! \param[out] U Strain energy densities at the points (for \a iop = 3)
+  //! \param[in] fe Finite element quantities at the points
+  //! \param[in] X Cartesian coordinates of the points
+  //! \param[in] eps Strain tensors at the points
+  //! \param[in] iop Calculation option, see the single-point method
+  //! \param[in] prm Nonlinear solution algorithm parameters
+  //!
+  //! \details This method is intended for small-strain material models,
+  //! where the strain tensor also acts as the deformation gradient argument.
+  //! The default implementation invokes the single-point method for each point.
+  //! Sub-classes may reimplement it to avoid the virtual call overhead and the
+  //! repeated set-up of the constitutive matrix for each point.
+  //! It is used by Elasticity::evalStresses() for the element-wise stress
+  //! evaluation of the load combinations. The integrands are still invoked
+  //! point by point by the kernel, and use the single-point method.
+  virtual bool evaluate(std::vector<Matrix>& C, std::vector<SymmTensor>& sigma,
+                        std::vector<double>& U,
+                        const std::vector<const FiniteElement*>& fe,
+                        const std::vector<Vec3>& X,
+                        const std::vector<SymmTensor>& eps,
+                        char iop = 1, const TimeDomain* prm = nullptr) const;
+
   //! \brief Evaluates the Lame-parameters at an integration point.
   virtual bool evaluate(double&, double&, const FiniteElement&,
                         const Vec3&) const { return false; }
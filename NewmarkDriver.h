@@ -71,6 +71,11 @@ public:
   //! \param writer HDF5 results exporter
   //! \param[in] ztol Truncate norm values smaller than this to zero
   //! \param[in] outPrec Number of digits after the decimal point in norm print
+  //!
+  //! \details The secondary solution is projected at the save steps only.
+  //! The projection system is assembled and solved by SIMbase::project()
+  //! in each of these steps, since its factorization is not exposed by the
+  //! kernel and therefore cannot be reused by this driver.
   int solveProblem(DataExporter* writer,
                    double ztol = 1.0e-8, std::streamsize outPrec = 0)
   {
@@ -101,21 +106,23 @@ public:
         break;
       }
 
-      if (doProject)
-      {
-        // Project the secondary results onto the spline basis
-        Newmark::model.setMode(SIM::RECOVERY);
-        if (!Newmark::model.project(proSol,Newmark::solution.front(),
-                                    pi->first,params.time))
-          status += 6;
-      }
-
       // Print solution components at the user-defined points
       utl::LogStream log(*os);
       this->dumpResults(params.time.t,log,ptPrec,pointfile.empty());
 
       if (params.hasReached(nextSave))
       {
+        // Project the secondary results onto the spline basis.
+        // This is done at the save steps only, since the projected
+        // solution is not used by the other steps.
+        if (doProject)
+        {
+          Newmark::model.setMode(SIM::RECOVERY);
+          if (!Newmark::model.project(proSol,Newmark::solution.front(),
+                                      pi->first,params.time))
+            status += 6;
+        }
+
         // Save solution variables to VTF
         if (Newmark::opt.format >= 0)
           if (!this->saveStep(++iStep,params.time.t) ||
@@ -16,8 +16,10 @@
 
 #include "NonLinSIM.h"
 #include "TimeStep.h"
+#include "Vec3.h"
 
 class DataExporter;
+class BoundaryForces;
 
 
 /*!
@@ -35,8 +37,8 @@ public:
   //! \param sim Reference to the spline FE model
   //! \param linear If \e true, use a linear driver (no Newton iterations)
   NonlinearDriver(SIMbase& sim, bool linear = false);
-  //! \brief Empty destructor.
-  virtual ~NonlinearDriver() {}
+  //! \brief The destructor frees the boundary force integrand.
+  virtual ~NonlinearDriver();
 
 protected:
   //! \brief Parses a data section from an input stream.
@@ -60,6 +62,12 @@ protected:
   //! \param[in] os The output stream to write the norms to
   virtual void printNorms(const Vector& norm, utl::LogStream& os) const;
 
+  //! \brief Computes the force resultants of the requested boundaries.
+  //! \param[out] forces Force (and torque) resultants for each boundary
+  //! \details The boundary quadrature is recorded at the first invocation,
+  //! and all boundaries are then evaluated in one parallel pass.
+  bool boundaryForces(Vectors& forces);
+
 public:
   //! \brief Invokes the main pseudo-time stepping simulation loop.
   //! \param writer HDF5 results exporter
@@ -84,6 +92,11 @@ private:
   TimeStep params; //!< Time stepping parameters
   bool     calcEn; //!< Flag for calculation of solution energy norm
   Matrix   proSol; //!< Projected secondary solution
+
+  std::vector<int> forceCodes; //!< Boundaries to compute force resultants for
+  Vec3             forceX0;    //!< Reference point for the torque resultants
+  bool             forceTorq;  //!< If \e true, compute torque resultants too
+  BoundaryForces*  bForces;    //!< Boundary force integrand
 };
 
 #endif
@@ -0,0 +1,156 @@
+// $Id$
+//==============================================================================
+//!
+//! \file PointCache.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author IFEM team / SINTEF
+//!
+//! \brief Cache of point-wise quantities at the integration points.
+//!
+//==============================================================================
+
+#ifndef _POINT_CACHE_H
+#define _POINT_CACHE_H
+
+#include "Vec3.h"
+#include <unordered_map>
+#include <functional>
+#include <vector>
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+
+
+/*!
+  \brief Class template caching a point-wise quantity at integration points.
+
+  \details The values are keyed by the Cartesian coordinates of the point,
+  such that they are reused by all later passes over the same points. After a
+  mesh refinement this holds for the elements that were not refined, since
+  the integration points of such elements do not move, whereas the points of
+  the refined elements are new and therefore evaluated again. Hence, no
+  explicit tracking of the refined elements is needed.
+
+  The cache is read-only during an integration pass, such that it can be
+  searched by several threads without locking. The values evaluated during
+  the pass are collected in separate arrays for each thread, and are merged
+  into the cache at the end of the pass. The cached quantity must therefore
+  be independent of the primary solution and of time.
+*/
+
+template<class T> class PointCache
+{
+public:
+  //! \brief Empty default constructor.
+  PointCache() {}
+  //! \brief Empty destructor.
+  virtual ~PointCache() {}
+
+  //! \brief Prepares the cache for a new integration pass.
+  void beginPass()
+  {
+    size_t nThread = 1;
+#ifdef USE_OPENMP
+    nThread = omp_get_max_threads();
+#endif
+    newValues.clear();
+    newValues.resize(nThread);
+    nLookups.clear();
+    nLookups.resize(nThread,0);
+  }
+
+  //! \brief Merges the values evaluated during the pass into the cache.
+  //! \details The cache is cleared first if it holds more than twice the
+  //! number of points visited in the pass, i.e., when it is dominated by
+  //! points of elements that no longer exist after a refinement.
+  void endPass()
+  {
+    size_t nPoints = 0;
+    for (size_t t = 0; t < nLookups.size(); t++)
+      nPoints += nLookups[t];
+
+    if (nPoints > 0 && values.size() > 2*nPoints)
+      values.clear();
+
+    for (size_t t = 0; t < newValues.size(); t++)
+      for (size_t i = 0; i < newValues[t].size(); i++)
+        values.insert(newValues[t][i]);
+
+    newValues.clear();
+    nLookups.clear();
+  }
+
+  //! \brief Returns the cached value at a point, if any.
+  //! \param[in] X Cartesian coordinates of the point
+  //! \return Pointer to the cached value, or null if not cached
+  const T* find(const Vec3& X)
+  {
+    size_t t = thread();
+    if (t >= nLookups.size())
+      return nullptr; // Outside a pass, or more threads than expected
+
+    ++nLookups[t];
+    typename ValueMap::const_iterator it = values.find(X);
+    return it == values.end() ? nullptr : &it->second;
+  }
+
+  //! \brief Stores a new value at a point.
+  //! \param[in] X Cartesian coordinates of the point
+  //! \param[in] value The value to store
+  //! \return Reference to the stored value (valid until the next insertion)
+  const T& insert(const Vec3& X, const T& value)
+  {
+    size_t t = thread();
+    if (t >= newValues.size())
+      return value;
+
+    newValues[t].push_back(std::make_pair(X,value));
+    return newValues[t].back().second;
+  }
+
+private:
+  //! \brief Returns the index of the current thread.
+  static size_t thread()
+  {
+#ifdef USE_OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+  }
+
+  //! \brief Hash function for point coordinates.
+  struct PointHash
+  {
+    //! \brief Returns the hash value of a point.
+    size_t operator()(const Vec3& X) const
+    {
+      std::hash<double> h;
+      size_t seed = h(X.x);
+      seed ^= h(X.y) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      seed ^= h(X.z) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      return seed;
+    }
+  };
+
+  //! \brief Exact equality of point coordinates.
+  struct PointEqual
+  {
+    //! \brief Returns \e true if the two points are bitwise equal.
+    bool operator()(const Vec3& a, const Vec3& b) const
+    { return a.x == b.x && a.y == b.y && a.z == b.z; }
+  };
+
+  //! \brief Cached point values.
+  typedef std::unordered_map<Vec3,T,PointHash,PointEqual> ValueMap;
+  //! \brief Point values evaluated by one thread.
+  typedef std::vector< std::pair<Vec3,T> > PointValues;
+
+  ValueMap                 values;    //!< Cached values from previous passes
+  std::vector<PointValues> newValues; //!< New values of each thread
+  std::vector<size_t>      nLookups;  //!< Number of lookups of each thread
+};
+
+#endif
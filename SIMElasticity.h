@@ -16,13 +16,21 @@
 
 #include "IFEM.h"
 #include "LinearElasticity.h"
+#include "HDF5NodalField.h"
+#include "LumpedRecovery.h"
 #include "MaterialBase.h"
+#include "CompiledFunctions.h"
 #include "Property.h"
 #include "TimeStep.h"
 #include "AnaSol.h"
+#include "StressBatch.h"
 #include "Functions.h"
 #include "Utilities.h"
+#include "ASMbase.h"
 #include "tinyxml.h"
+#include <sstream>
+#include <cmath>
+#include <set>
 
 typedef std::vector<Material*> MaterialVec; //!< Convenience declaration
 
@@ -39,10 +47,15 @@ template<class Dim> class SIMElasticity : public Dim
 public:
   //! \brief Default constructor.
   //! \param[in] checkRHS If \e true, ensure the model is in a right-hand system
-  SIMElasticity(bool checkRHS = false) : Dim(Dim::dimension,checkRHS)
+  //! \param[in] lumped If \e true, also estimate the error by lumped recovery
+  SIMElasticity(bool checkRHS = false, bool lumped = false)
+    : Dim(Dim::dimension,checkRHS), lumpedRec(lumped)
   {
     myContext = "elasticity";
     aCode = 0;
+    roiBox = false;
+    roiMin = Vec3(-HUGE_VAL,-HUGE_VAL,-HUGE_VAL);
+    roiMax = Vec3( HUGE_VAL, HUGE_VAL, HUGE_VAL);
   }
 
   //! \brief The destructor frees the dynamically allocated material properties.
@@ -60,15 +73,98 @@ public:
   virtual std::string getName() const { return "Elasticity"; }
 
   //! \brief Advances the time step one step forward.
+  //! \details If the temperatures are read from file,
+  //! the temperature field of the new time step is also read.
   virtual bool advanceStep(TimeStep& tp)
   {
     Elasticity* elp = dynamic_cast<Elasticity*>(Dim::myProblem);
     if (elp)
       elp->advanceStep(tp.time.dt,tp.time.dtn);
 
+    return this->readTemperature(tp.step);
+  }
+
+  //! \brief Returns the material properties of the model.
+  const MaterialVec& getMaterials() const { return mVec; }
+  //! \brief Appends the material property assignments to a property vector.
+  //! \details This is used by other simulators sharing the same patches.
+  void getMaterialProperties(PropertyVec& props) const
+  {
+    PropertyVec::const_iterator p;
+    for (p = Dim::myProps.begin(); p != Dim::myProps.end(); ++p)
+      if (p->pcode == Property::MATERIAL)
+        props.push_back(*p);
+  }
+
+  //! \brief Reads the nodal temperature field of a given step from file.
+  //! \param[in] step Time step counter, the field is read from the time level
+  //! of the temperature file which is offset by this value
+  bool readTemperature(int step)
+  {
+    LinearElasticity* lep = dynamic_cast<LinearElasticity*>(Dim::myProblem);
+    if (!lep || !lep->getTemperatureInput())
+      return true; // No nodal temperature input
+
+    Vector T;
+    const HDF5NodalField* input = lep->getTemperatureInput();
+    if (!input->read(*this,input->getFirstLevel()+step,T))
+      return false;
+
+    lep->setTemperature(T);
     return true;
   }
 
+  using Dim::solutionNorms;
+  //! \brief Integrates some solution norm quantities.
+  //! \param[in] time Parameters for nonlinear/time-dependent simulations
+  //! \param[in] psol Primary solution vectors
+  //! \param[in] ssol Secondary solution vectors
+  //! \param[out] gNorm Global norm quantities
+  //! \param[out] eNorm Element-wise norm quantities
+  //! \param[in] name Name of solution field (for messages)
+  //!
+  //! \details This method is reimplemented to append the secondary solution
+  //! recovered by a lumped L2-projection to the projected solutions \a ssol,
+  //! if requested. Its error estimates are then the last norm group, which
+  //! also makes them available as error indicator in adaptive simulations.
+  virtual bool solutionNorms(const TimeDomain& time,
+                             const Vectors& psol, const Vectors& ssol,
+                             Vectors& gNorm, Matrix* eNorm = nullptr,
+                             const char* name = nullptr)
+  {
+    if (!lumpedRec || psol.empty())
+      return this->Dim::solutionNorms(time,psol,ssol,gNorm,eNorm,name);
+
+    LumpedRecovery recovery(*Dim::myProblem);
+    Elasticity* elp = dynamic_cast<Elasticity*>(Dim::myProblem);
+    if (elp) recovery.setElements(elp->getRegionOfInterest());
+
+    Vectors rsol(ssol);
+    rsol.push_back(Vector());
+    if (!recovery.recover(rsol.back(),*this,psol.front()))
+      return false;
+
+    return this->Dim::solutionNorms(time,psol,rsol,gNorm,eNorm,name);
+  }
+
+  using Dim::extractPatchSolution;
+  //! \brief Extracts all local solution vector(s) for a specified patch.
+  //! \param[in] problem Integrand to receive the patch-level solution vectors
+  //! \param[in] sol Global primary solution vectors in DOF-order
+  //! \param[in] pindx Local patch index to extract solution vectors for
+  //!
+  //! \details This method is reimplemented to also extract the nodal
+  //! temperatures of the patch, if a nodal temperature field is assigned.
+  virtual size_t extractPatchSolution(IntegrandBase* problem,
+                                      const Vectors& sol, size_t pindx) const
+  {
+    LinearElasticity* lep = dynamic_cast<LinearElasticity*>(problem);
+    if (lep && pindx < Dim::myModel.size())
+      lep->initPatchTemperature(*Dim::myModel[pindx]);
+
+    return this->Dim::extractPatchSolution(problem,sol,pindx);
+  }
+
   //! \brief Initializes the property containers of the model.
   virtual void clearProperties()
   {
@@ -131,13 +227,120 @@ protected:
         if (stressField)
         {
           p->pcode = Property::NEUMANN;
-          Dim::myTracs[p->pindx] = new TractionField(*stressField);
+          Dim::myTracs[p->pindx] = this->newTractionField(*stressField);
         }
         else
           p->pcode = Property::UNDEFINED;
       }
   }
 
+  //! \brief Creates a boundary traction field from an analytical stress field.
+  //! \details The traction is evaluated directly from the stress components
+  //! if the stress field supports batch evaluation.
+  static TractionFunc* newTractionField(STensorFunc& sigma)
+  {
+    const STensorBatch* sb = dynamic_cast<const STensorBatch*>(&sigma);
+    if (sb) return new BatchTractionField(*sb);
+    return new TractionField(sigma);
+  }
+
+  //! \brief Performs some pre-processing tasks on the FE model.
+  //! \details This method is reimplemented to read the initial nodal
+  //! temperature field, if any, now that the global node numbers are known.
+  //! The elements in the region of interest, if any, are also flagged.
+  virtual bool preprocessB()
+  {
+    return this->Dim::preprocessB() && this->readTemperature(0) &&
+      this->initRegionOfInterest();
+  }
+
+  //! \brief Flags the elements in the region of interest, if defined.
+  //! \details An element is in the region if its patch is listed explicitly
+  //! or is referred by one of the topology sets, or if the bounding box of its
+  //! nodal points intersects the box of the region.
+  bool initRegionOfInterest()
+  {
+    if (roiPatches.empty() && roiSets.empty() && !roiBox)
+      return true;
+
+    Elasticity* elp = dynamic_cast<Elasticity*>(Dim::myProblem);
+    if (!elp) return true;
+
+    // Find the (local) patch indices of the patches in the region
+    std::set<size_t> patches;
+    for (size_t i = 0; i < roiPatches.size(); i++)
+    {
+      int pid = this->getLocalPatchIndex(roiPatches[i]);
+      if (pid < 0) return false;
+      if (pid > 0) patches.insert(pid);
+    }
+    for (size_t i = 0; i < roiSets.size(); i++)
+    {
+      TopologySet::const_iterator tit = Dim::myEntitys.find(roiSets[i]);
+      if (tit == Dim::myEntitys.end())
+      {
+        std::cerr <<"  ** SIMElasticity::initRegionOfInterest: Undefined"
+                  <<" topology set \""<< roiSets[i] <<"\" (ignored)."
+                  << std::endl;
+        continue;
+      }
+      // The topology sets refer to global patch numbers
+      TopEntity::const_iterator it;
+      for (it = tit->second.begin(); it != tit->second.end(); ++it)
+      {
+        int pid = this->getLocalPatchIndex(it->patch);
+        if (pid < 0) return false;
+        if (pid > 0) patches.insert(pid);
+      }
+    }
+
+    Matrix Xnod;
+    size_t nroi = 0;
+    std::vector<bool> elms(this->getNoElms(),false);
+    for (size_t p = 0; p < Dim::myModel.size(); p++)
+    {
+      const ASMbase* pch = Dim::myModel[p];
+      bool allElms = patches.find(p+1) != patches.end();
+      for (size_t e = 1; e <= pch->getNoElms(true); e++)
+      {
+        int iel = pch->getElmID(e);
+        if (iel < 1 || (size_t)iel > elms.size() || elms[iel-1])
+          continue;
+        else if (allElms)
+          elms[iel-1] = true;
+        else if (roiBox && pch->getElementCoordinates(Xnod,e))
+          elms[iel-1] = this->intersectsRegion(Xnod);
+        if (elms[iel-1]) ++nroi;
+      }
+    }
+
+    IFEM::cout <<"\nRegion of interest: "<< nroi <<" of "<< elms.size()
+               <<" elements"<< std::endl;
+    elp->setRegionOfInterest(elms);
+    return true;
+  }
+
+  //! \brief Checks if the bounding box of some points intersects the region.
+  //! \param[in] X Nodal point coordinates of an element
+  bool intersectsRegion(const Matrix& X) const
+  {
+    if (X.cols() < 1) return false;
+
+    for (size_t d = 1; d <= X.rows() && d <= 3; d++)
+    {
+      double xmin = X(d,1), xmax = X(d,1);
+      for (size_t j = 2; j <= X.cols(); j++)
+        if (X(d,j) < xmin)
+          xmin = X(d,j);
+        else if (X(d,j) > xmax)
+          xmax = X(d,j);
+      if (xmax < roiMin[d-1] || xmin > roiMax[d-1])
+        return false;
+    }
+
+    return true;
+  }
+
 public:
   static bool planeStrain; //!< Plane strain/stress option - 2D only
   static bool axiSymmetry; //!< Axisymmtry option - 2D only
@@ -245,7 +448,8 @@ protected:
           IFEM::cout <<"\tTraction on P"<< press.patch
                     << (Dim::dimension==3?" F":" E")
                     << (int)press.lindx << std::endl;
-          Dim::myTracs[1+i] = new TractionField(*Dim::mySol->getStressSol());
+          Dim::myTracs[1+i] =
+            this->newTractionField(*Dim::mySol->getStressSol());
         }
         else
         {
@@ -354,10 +558,13 @@ protected:
       else if (!strcasecmp(child->Value(),"isotropic")) {
         int code = this->parseMaterialSet(child,mVec.size());
         IFEM::cout <<"\tMaterial code "<< code <<":";
+        Material* mat;
         if (Dim::dimension == 2)
-          mVec.push_back(this->getIntegrand()->parseMatProp(child,planeStrain));
+          mat = this->getIntegrand()->parseMatProp(child,planeStrain);
         else
-          mVec.push_back(this->getIntegrand()->parseMatProp(child));
+          mat = this->getIntegrand()->parseMatProp(child);
+        if (!mat) return false;
+        mVec.push_back(mat);
       }
 
       else if (!strcasecmp(child->Value(),"bodyforce")) {
@@ -369,12 +576,40 @@ protected:
           utl::getAttribute(child,"type",type,true);
           IFEM::cout <<"\tBodyforce code "<< code;
           if (!type.empty()) IFEM::cout <<" ("<< type <<")";
-          VecFunc* f = utl::parseVecFunc(child->FirstChild()->Value(),type);
+          const char* value = child->FirstChild()->Value();
+          VecFunc* f = CompiledVecFunc::parse(value,type);
           if (f) this->setVecProperty(code,Property::BODYLOAD,f);
           IFEM::cout << std::endl;
         }
       }
 
+      else if (!strcasecmp(child->Value(),"roi")) {
+        std::string patches, set;
+        IFEM::cout <<"\tRegion of interest:";
+        if (utl::getAttribute(child,"patches",patches)) {
+          int patch;
+          std::istringstream pis(patches);
+          while (pis >> patch)
+            roiPatches.push_back(patch);
+          IFEM::cout <<" patches "<< patches;
+        }
+        if (utl::getAttribute(child,"set",set)) {
+          roiSets.push_back(set);
+          IFEM::cout <<" set "<< set;
+        }
+        const char* minTag[3] = { "xmin", "ymin", "zmin" };
+        const char* maxTag[3] = { "xmax", "ymax", "zmax" };
+        for (int d = 0; d < 3; d++) {
+          if (utl::getAttribute(child,minTag[d],roiMin[d]))
+            roiBox = true;
+          if (utl::getAttribute(child,maxTag[d],roiMax[d]))
+            roiBox = true;
+        }
+        if (roiBox)
+          IFEM::cout <<" box ["<< roiMin <<"] - ["<< roiMax <<"]";
+        IFEM::cout << std::endl;
+      }
+
       else if (!this->getIntegrand()->parse(child))
         this->Dim::parse(child);
 
@@ -422,6 +657,7 @@ protected:
     else
       return false;
 
+    elp->setLoadCase(propInd);
     return true;
   }
 
@@ -430,7 +666,14 @@ protected:
   std::string myContext; //!< XML-tag to search for problem inputs within
 
 private:
-  int aCode; //!< Analytical BC code (used by destructor)
+  int  aCode;     //!< Analytical BC code (used by destructor)
+  bool lumpedRec; //!< If \e true, append the lumped recovery to projections
+
+  std::vector<int>         roiPatches; //!< Patches in the region of interest
+  std::vector<std::string> roiSets;    //!< Topology sets in the region
+  Vec3 roiMin; //!< Lower corner of the bounding box of the region
+  Vec3 roiMax; //!< Upper corner of the bounding box of the region
+  bool roiBox; //!< If \e true, the region includes a bounding box
 };
 
 #endif
@@ -0,0 +1,252 @@
+// $Id$
+//==============================================================================
+//!
+//! \file SIMHeatConduction.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author IFEM team / SINTEF
+//!
+//! \brief Solution driver for heat conduction in thermo-elastic analysis.
+//!
+//==============================================================================
+
+#ifndef _SIM_HEAT_CONDUCTION_H
+#define _SIM_HEAT_CONDUCTION_H
+
+#include "SIMElasticity.h"
+#include "HeatConduction.h"
+
+
+/*!
+  \brief Driver class for the heat conduction stage of thermo-elastic analysis.
+
+  \details This class solves the steady or transient heat equation on the same
+  model as an associated elasticity simulator, using the same material objects
+  and the same quadrature. The temperature solution is handed over in memory
+  to the linear elasticity integrand, which then uses it for the thermal
+  strains, without any file exchange between the two stages. The patches are
+  read from the same geometry definition as for the elasticity simulator, and
+  must be preprocessed in the same way, such that the node numbering of the
+  two simulators is identical. This is checked before the temperatures are
+  handed over.
+
+  The input is read from the \a heatconduction section of the input file,
+  which may contain its own \a boundaryconditions section, besides the heat
+  \a source, boundary heat \a flux and \a initialtemperature definitions.
+  The global boundary conditions section applies to the elasticity problem
+  only, and is ignored here.
+*/
+
+template<class Dim> class SIMHeatConduction : public Dim
+{
+public:
+  //! \brief The constructor binds the simulator to an elasticity simulator.
+  //! \param elastic The elasticity simulator to share the model with
+  SIMHeatConduction(SIMElasticity<Dim>& elastic) : Dim(1), elSim(elastic)
+  {
+    Dim::myProblem = new HeatConduction(Dim::dimension);
+    T0 = 0.0;
+  }
+
+  //! \brief Empty destructor.
+  virtual ~SIMHeatConduction() {}
+
+  //! \brief Returns the name of this simulator (for use in the HDF5 export).
+  virtual std::string getName() const { return "HeatConduction"; }
+
+  //! \brief Initializes the equation system and the temperature solution.
+  bool initSolution()
+  {
+    Dim::opt.nGauss[0] = elSim.opt.nGauss[0];
+    Dim::opt.nGauss[1] = elSim.opt.nGauss[1];
+    this->setMode(SIM::STATIC);
+    this->setQuadratureRule(Dim::opt.nGauss[0],true);
+    if (!this->initSystem(elSim.opt.solver,1,1))
+      return false;
+
+    temperature.resize(this->getNoDOFs());
+    std::fill(temperature.begin(),temperature.end(),T0);
+    return true;
+  }
+
+  //! \brief Solves the heat conduction problem for one time step.
+  //! \param[in] tp Time stepping parameters
+  //! \param[in] steady If \e true, solve the steady state problem
+  bool solveStep(const TimeStep& tp, bool steady = false)
+  {
+    HeatConduction* heat = static_cast<HeatConduction*>(Dim::myProblem);
+    heat->setTimeStep(steady ? 0.0 : tp.time.dt);
+
+    if (Dim::msgLevel >= 1)
+      IFEM::cout <<"\n  Solving the heat conduction problem"
+                 << (steady ? " (steady state)" : "") << std::endl;
+
+    this->setMode(SIM::STATIC);
+    if (!this->assembleSystem(tp.time,Vectors(1,temperature)))
+      return false;
+
+    return this->solveSystem(temperature,Dim::msgLevel-1);
+  }
+
+  //! \brief Hands the current temperature solution over to the elasticity.
+  bool transferTemperature() const
+  {
+    LinearElasticity* lep;
+    lep = dynamic_cast<LinearElasticity*>(elSim.getProblem());
+    if (!lep)
+    {
+      std::cerr <<" *** SIMHeatConduction::transferTemperature:"
+                <<" No linear elasticity problem."<< std::endl;
+      return false;
+    }
+    else if (temperature.size() != elSim.getNoNodes())
+    {
+      std::cerr <<" *** SIMHeatConduction::transferTemperature: The thermal"
+                <<" model has "<< temperature.size() <<" nodes, whereas the"
+                <<" elastic model has "<< elSim.getNoNodes() << std::endl;
+      return false;
+    }
+    else if (!this->haveSameNodes())
+      return false;
+
+    lep->setTemperature(temperature);
+    return true;
+  }
+
+  //! \brief Returns the current temperature solution.
+  const Vector& getSolution() const { return temperature; }
+
+protected:
+  //! \brief Performs some pre-processing tasks on the FE model.
+  //! \details This method is reimplemented to assign the material properties
+  //! of the elasticity simulator to the same patches of this simulator.
+  virtual void preprocessA()
+  {
+    elSim.getMaterialProperties(Dim::myProps);
+    this->printProblem();
+  }
+
+  //! \brief Parses a data section from an XML element.
+  //! \param[in] elem The XML element to parse
+  virtual bool parse(const TiXmlElement* elem)
+  {
+    if (!strcasecmp(elem->Value(),"boundaryconditions"))
+      return true; // These belong to the elasticity problem
+
+    else if (strcasecmp(elem->Value(),"heatconduction"))
+      return this->Dim::parse(elem);
+
+    HeatConduction* heat = static_cast<HeatConduction*>(Dim::myProblem);
+    const TiXmlElement* child = elem->FirstChildElement();
+    for (; child; child = child->NextSiblingElement())
+      if (!strcasecmp(child->Value(),"boundaryconditions"))
+        this->Dim::parse(child);
+
+      else if (!strcasecmp(child->Value(),"initialtemperature")) {
+        if (child->FirstChild())
+          T0 = atof(child->FirstChild()->Value());
+        IFEM::cout <<"\tInitial temperature "<< T0 << std::endl;
+      }
+
+      else if (!strcasecmp(child->Value(),"source") && child->FirstChild()) {
+        std::string type;
+        utl::getAttribute(child,"type",type,true);
+        IFEM::cout <<"\tHeat source";
+        if (!type.empty()) IFEM::cout <<" ("<< type <<")";
+        heat->setSource(CompiledRealFunc::parse(child->FirstChild()->Value(),
+                                                type));
+        IFEM::cout << std::endl;
+      }
+
+      else if (!strcasecmp(child->Value(),"flux") && child->FirstChild()) {
+        std::string set, type;
+        utl::getAttribute(child,"set",set);
+        int code = this->getUniquePropertyCode(set,1);
+        if (code == 0) utl::getAttribute(child,"code",code);
+        if (code > 0) {
+          utl::getAttribute(child,"type",type,true);
+          IFEM::cout <<"\tHeat flux code "<< code;
+          if (!type.empty()) IFEM::cout <<" ("<< type <<")";
+          this->setPropertyType(code,Property::NEUMANN);
+          // The flux functions are deleted by the SIMbase destructor
+          RealFunc*& flux = Dim::myScalars[code];
+          delete flux;
+          flux = CompiledRealFunc::parse(child->FirstChild()->Value(),type);
+          IFEM::cout << std::endl;
+        }
+      }
+
+      else
+        this->Dim::parse(child);
+
+    return true;
+  }
+
+  //! \brief Initializes material properties for integration of interior terms.
+  //! \param[in] propInd Physical property index
+  virtual bool initMaterial(size_t propInd)
+  {
+    const MaterialVec& mVec = elSim.getMaterials();
+    if (mVec.empty()) return false;
+
+    if (propInd >= mVec.size()) propInd = mVec.size()-1;
+
+    static_cast<HeatConduction*>(Dim::myProblem)->setMaterial(mVec[propInd]);
+    return true;
+  }
+
+  //! \brief Initializes for integration of Neumann terms for a given property.
+  //! \param[in] propInd Physical property index
+  virtual bool initNeumann(size_t propInd)
+  {
+    typename Dim::SclFuncMap::const_iterator sit = Dim::myScalars.find(propInd);
+    if (sit == Dim::myScalars.end()) return false;
+
+    static_cast<HeatConduction*>(Dim::myProblem)->setFlux(sit->second);
+    return true;
+  }
+
+private:
+  //! \brief Checks that the two simulators have the same node numbering.
+  //! \details The patches are read twice, once by each simulator, so a node
+  //! count check alone does not guarantee that the temperatures are handed
+  //! over to the right nodes, e.g., if the patches are ignored or merged
+  //! differently. Therefore, the global node numbers are compared patch by
+  //! patch, and node by node.
+  bool haveSameNodes() const
+  {
+    const PatchVec& elModel = elSim.getFEModel();
+    if (elModel.size() != Dim::myModel.size())
+    {
+      std::cerr <<" *** SIMHeatConduction::haveSameNodes: The thermal model"
+                <<" has "<< Dim::myModel.size() <<" patches, whereas the"
+                <<" elastic model has "<< elModel.size() << std::endl;
+      return false;
+    }
+
+    for (size_t p = 0; p < elModel.size(); p++)
+    {
+      const ASMbase* tpch = Dim::myModel[p];
+      const ASMbase* epch = elModel[p];
+      bool same = tpch->getNoNodes() == epch->getNoNodes();
+      for (size_t n = 1; n <= tpch->getNoNodes() && same; n++)
+        same = tpch->getNodeID(n) == epch->getNodeID(n);
+      if (!same)
+      {
+        std::cerr <<" *** SIMHeatConduction::haveSameNodes: The node numbering"
+                  <<" of patch "<< p+1 <<" differs in the thermal and elastic"
+                  <<" models."<< std::endl;
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  SIMElasticity<Dim>& elSim; //!< The associated elasticity simulator
+  Vector        temperature; //!< Current temperature solution
+  double                 T0; //!< Initial temperature
+};
+
+#endif
@@ -0,0 +1,112 @@
+// $Id$
+//==============================================================================
+//!
+//! \file StressBatch.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author IFEM team / SINTEF
+//!
+//! \brief Batch evaluation interface for analytical stress fields.
+//!
+//==============================================================================
+
+#ifndef _STRESS_BATCH_H
+#define _STRESS_BATCH_H
+
+#include "Function.h"
+#include "Tensor.h"
+#include "MatVec.h"
+
+
+/*!
+  \brief Structure-of-arrays of points and stress components.
+
+  \details The coordinate arrays and the component arrays are owned by the
+  caller. The component array \a s[k] receives the stress component \a k,
+  ordered as (11,22,33,12,23,13), at all points. Components that are not
+  defined for the stress field in question are set to zero.
+*/
+
+struct StressBatch
+{
+  size_t        n;    //!< Number of points
+  const double* x;    //!< X-coordinates of the points
+  const double* y;    //!< Y-coordinates of the points
+  const double* z;    //!< Z-coordinates of the points
+  double*       s[6]; //!< Stress components at the points
+};
+
+
+/*!
+  \brief Interface for analytical stress fields with batch evaluation.
+
+  \details The stress field is evaluated for an array of points at once,
+  where each component is stored in a separate array, such that the loop over
+  the points can be vectorized by the compiler. The single-point methods of
+  this class evaluate a batch of one point using stack storage only, and are
+  used where the points are processed one at a time, as in the numerical
+  integration loops.
+*/
+
+class STensorBatch
+{
+protected:
+  //! \brief The constructor defines the size of the stress tensors.
+  //! \param[in] n Number of spatial dimensions of the stress tensor
+  //! \param[in] zz If \e true, the 2D stress tensor includes sigma_zz
+  STensorBatch(unsigned short int n, bool zz) : nsd(n), withZZ(zz) {}
+
+public:
+  //! \brief Empty destructor.
+  virtual ~STensorBatch() {}
+
+  //! \brief Evaluates the stress tensor at a batch of points.
+  virtual void evaluate(const StressBatch& b) const = 0;
+
+  //! \brief Evaluates the stress tensor at a single point.
+  SymmTensor evalTensor(const Vec3& X) const;
+  //! \brief Evaluates the stress components at a single point.
+  //! \param[in] X Cartesian coordinates of the point
+  //! \param[out] sigma Stress components, ordered as in SymmTensor
+  void evalVector(const Vec3& X, Vector& sigma) const;
+  //! \brief Evaluates the traction \f$\sigma n\f$ at a single point.
+  //! \param[in] X Cartesian coordinates of the point
+  //! \param[in] n Outward-directed unit normal vector at the point
+  Vec3 evalTraction(const Vec3& X, const Vec3& n) const;
+
+private:
+  //! \brief Evaluates all six stress components at a single point.
+  void evalPoint(const Vec3& X, double* s) const;
+
+protected:
+  unsigned short int nsd;    //!< Number of spatial dimensions
+  bool               withZZ; //!< If \e true, 2D tensors include sigma_zz
+};
+
+
+/*!
+  \brief Traction field derived from an analytical stress field.
+
+  \details Unlike TractionField, this class contracts the stress components
+  with the normal vector directly, without forming the stress tensor.
+*/
+
+class BatchTractionField : public TractionFunc
+{
+public:
+  //! \brief The constructor initializes the stress field reference.
+  explicit BatchTractionField(const STensorBatch& s) : sigma(s) {}
+  //! \brief Empty destructor.
+  virtual ~BatchTractionField() {}
+
+protected:
+  //! \brief Evaluates the traction at point \a x with normal vector \a n.
+  virtual Vec3 evaluate(const Vec3& x, const Vec3& n) const
+  { return sigma.evalTraction(x,n); }
+
+private:
+  const STensorBatch& sigma; //!< The analytical stress field
+};
+
+#endif
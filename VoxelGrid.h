@@ -0,0 +1,96 @@
+// $Id$
+//==============================================================================
+//!
+//! \file VoxelGrid.h
+//!
+//! \date Oct 16 2026
+//!
+//! \author IFEM team / SINTEF
+//!
+//! \brief Memory-mapped scalar field on a regular voxel grid.
+//!
+//==============================================================================
+
+#ifndef _VOXEL_GRID_H
+#define _VOXEL_GRID_H
+
+#include <string>
+#include <cstddef>
+
+class Vec3;
+class TiXmlElement;
+
+
+/*!
+  \brief Class representing a scalar field on a regular 3D voxel grid.
+
+  \details The voxel values are read from a raw binary file, or from a
+  contiguous (non-chunked and uncompressed) dataset in an HDF5 file.
+  The file is memory-mapped, such that only the pages that are actually
+  referenced are loaded. The grid can therefore be much larger than the
+  available memory. The voxel values are assumed to be stored with the
+  x-index running fastest, and represent the field value in the voxel centers.
+
+  The field value at a given point is found in constant time, either as the
+  value of the voxel containing the point, or by trilinear interpolation
+  between the eight closest voxel centers. A linear mapping,
+  \a shift + \a scale * value, may be applied on the voxel values.
+*/
+
+class VoxelGrid
+{
+public:
+  //! \brief Default constructor.
+  VoxelGrid();
+  //! \brief The destructor unmaps the voxel data.
+  ~VoxelGrid() { this->close(); }
+
+  //! \brief Parses the voxel grid definition from an XML-element.
+  bool parse(const TiXmlElement* elem);
+
+  //! \brief Memory-maps the voxel values from a raw binary file.
+  //! \param[in] fileName Name of the file to map
+  //! \param[in] offset Byte offset of the first voxel value in the file
+  bool openRaw(const std::string& fileName, size_t offset = 0);
+  //! \brief Memory-maps the voxel values from an HDF5 dataset.
+  //! \param[in] fileName Name of the HDF5 file
+  //! \param[in] dataset Name of the dataset containing the voxel values
+  bool openHDF5(const std::string& fileName, const std::string& dataset);
+  //! \brief Unmaps the voxel data.
+  void close();
+
+  //! \brief Returns the (mapped) field value at the given point.
+  double getValue(const Vec3& X) const;
+
+  //! \brief Returns the number of voxels in the grid.
+  size_t size() const { return n[0]*n[1]*n[2]; }
+
+  //! \brief Prints out the grid definition to the log stream.
+  void printLog() const;
+
+private:
+  //! \brief Enum defining the supported voxel value types.
+  enum ValueType { UINT8, UINT16, FLOAT32, FLOAT64 };
+
+  //! \brief Returns the size in bytes of a single voxel value.
+  size_t valueSize() const;
+  //! \brief Returns the unmapped value of the voxel with the given index.
+  double voxel(size_t i, size_t j, size_t k) const;
+  //! \brief Maps a file region into memory.
+  bool mapFile(const std::string& fileName, size_t offset);
+
+  size_t    n[3];    //!< Number of voxels in each direction
+  double    X0[3];   //!< Coordinates of the grid corner
+  double    h[3];    //!< Voxel size in each direction
+  double    scale;   //!< Scaling factor applied to the voxel values
+  double    shift;   //!< Shift applied to the scaled voxel values
+  ValueType type;    //!< Voxel value type
+  bool      linear;  //!< If \e true, use trilinear interpolation
+
+  void*       mapBase; //!< Start address of the memory-mapped region
+  size_t      mapSize; //!< Size of the memory-mapped region
+  const char* data;    //!< Pointer to the first voxel value
+  std::string source;  //!< Name of the mapped file
+};
+
+#endif